@@ -0,0 +1,177 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_CACHING_TRANSFORM_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_CACHING_TRANSFORM_ITERATOR_HPP_INCLUDED_
+
+#include <iterator>
+#include <type_traits>
+
+#include <boost/core/use_default.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/iterator/enable_if_convertible.hpp>
+#include <boost/iterator/detail/eval_if_default.hpp>
+
+namespace boost {
+namespace iterators {
+
+template<
+    typename UnaryFunction,
+    typename Iterator,
+    typename Value = use_default
+>
+class caching_transform_iterator;
+
+namespace detail {
+
+template< typename UnaryFunc, typename Iterator >
+struct caching_transform_iterator_default_value
+{
+    using type = typename std::remove_cv<
+        typename std::remove_reference<
+            decltype(std::declval< UnaryFunc const& >()(std::declval< typename std::iterator_traits< Iterator >::reference >()))
+        >::type
+    >::type;
+};
+
+template< typename UnaryFunc, typename Iterator, typename Value >
+struct caching_transform_iterator_base
+{
+    // By default, the value type is the result type of the function
+    // with references and cv-qualifiers removed.
+    using value_type = detail::eval_if_default_t<
+        Value,
+        caching_transform_iterator_default_value< UnaryFunc, Iterator >
+    >;
+
+    using type = iterator_adaptor<
+        caching_transform_iterator< UnaryFunc, Iterator, Value >,
+        Iterator,
+        value_type,
+        use_default,    // Leave the traversal category alone
+        value_type const&
+    >;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// caching_transform_iterator class definition
+//
+// Like transform_iterator, but stores the result of the function for
+// the current position, so that dereferencing the same position
+// multiple times calls the function only once. The stored result is
+// discarded when the iterator is moved.
+//
+// Dereferencing returns a reference to the result stored in the
+// iterator, which is only valid until the iterator is moved or
+// destroyed.
+//
+template< typename UnaryFunc, typename Iterator, typename Value >
+class caching_transform_iterator :
+    public detail::caching_transform_iterator_base< UnaryFunc, Iterator, Value >::type,
+    private boost::empty_value< UnaryFunc >
+{
+    friend class iterator_core_access;
+
+    template< typename, typename, typename >
+    friend class caching_transform_iterator;
+
+private:
+    using super_t = typename detail::caching_transform_iterator_base< UnaryFunc, Iterator, Value >::type;
+    using functor_base = boost::empty_value< UnaryFunc >;
+
+public:
+    using value_type = typename super_t::value_type;
+    using reference = typename super_t::reference;
+    using difference_type = typename super_t::difference_type;
+
+    caching_transform_iterator() = default;
+
+    caching_transform_iterator(Iterator const& x, UnaryFunc f) :
+        super_t(x),
+        functor_base(boost::empty_init_t{}, f)
+    {}
+
+    // don't provide this constructor if UnaryFunc is a
+    // function pointer type, since it will be 0.  Too dangerous.
+    template< bool Requires = std::is_class< UnaryFunc >::value, typename = typename std::enable_if< Requires >::type >
+    explicit caching_transform_iterator(Iterator const& x) :
+        super_t(x)
+    {}
+
+    template<
+        typename OtherIterator,
+        typename = enable_if_convertible_t< OtherIterator, Iterator >
+    >
+    caching_transform_iterator(caching_transform_iterator< UnaryFunc, OtherIterator, Value > const& t) :
+        super_t(t.base()),
+        functor_base(boost::empty_init_t{}, t.functor())
+    {}
+
+    UnaryFunc functor() const { return functor_base::get(); }
+
+    // Returns true if the result for the current position is stored
+    bool is_cached() const noexcept { return !!m_value; }
+
+private:
+    reference dereference() const
+    {
+        if (!m_value)
+            m_value = functor_base::get()(*this->base());
+        return m_value.get();
+    }
+
+    void increment()
+    {
+        m_value.reset();
+        ++this->base_reference();
+    }
+
+    void decrement()
+    {
+        m_value.reset();
+        --this->base_reference();
+    }
+
+    void advance(difference_type n)
+    {
+        m_value.reset();
+        this->base_reference() += n;
+    }
+
+private:
+    mutable optional< value_type > m_value;
+};
+
+template< typename UnaryFunc, typename Iterator >
+inline caching_transform_iterator< UnaryFunc, Iterator > make_caching_transform_iterator(Iterator it, UnaryFunc fun)
+{
+    return caching_transform_iterator< UnaryFunc, Iterator >(it, fun);
+}
+
+// Version which allows explicit specification of the UnaryFunc
+// type. Not provided for function pointer types, see make_transform_iterator.
+template< typename UnaryFunc, typename Iterator >
+inline typename std::enable_if<
+    std::is_class< UnaryFunc >::value,
+    caching_transform_iterator< UnaryFunc, Iterator >
+>::type make_caching_transform_iterator(Iterator it)
+{
+    return caching_transform_iterator< UnaryFunc, Iterator >(it);
+}
+
+} // namespace iterators
+
+using iterators::caching_transform_iterator;
+using iterators::make_caching_transform_iterator;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_CACHING_TRANSFORM_ITERATOR_HPP_INCLUDED_
@@ -0,0 +1,346 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_COROUTINE_GENERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_COROUTINE_GENERATOR_HPP_INCLUDED_
+
+#include <boost/config.hpp>
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902l) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define BOOST_ITERATOR_HAS_COROUTINE_GENERATOR
+#endif
+#endif
+
+#if defined(BOOST_ITERATOR_HAS_COROUTINE_GENERATOR)
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename T >
+class coroutine_generator;
+
+namespace detail {
+
+// Coroutine frames are followed by a pointer to the function that
+// deallocates them and, if the frame was allocated with an allocator,
+// a copy of that allocator.
+class coroutine_frame_allocation
+{
+private:
+    using deallocate_function = void (*)(void* frame, std::size_t size) noexcept;
+
+    static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+    static constexpr std::size_t align_up(std::size_t size, std::size_t align) noexcept
+    {
+        return (size + align - 1u) & ~(align - 1u);
+    }
+
+    static constexpr std::size_t function_offset(std::size_t size) noexcept
+    {
+        return align_up(size, alignof(deallocate_function));
+    }
+
+    static constexpr std::size_t allocator_offset(std::size_t size, std::size_t align) noexcept
+    {
+        return align_up(function_offset(size) + sizeof(deallocate_function), align);
+    }
+
+    template< typename Alloc >
+    static constexpr std::size_t blocks(std::size_t size) noexcept
+    {
+        return align_up(allocator_offset(size, alignof(Alloc)) + sizeof(Alloc), alignment) / alignment;
+    }
+
+    template< typename Alloc >
+    using block_allocator = typename std::allocator_traits< Alloc >::template rebind_alloc< std::max_align_t >;
+
+    template< typename Alloc >
+    static void deallocate_with(void* frame, std::size_t size) noexcept
+    {
+        unsigned char* const p = static_cast< unsigned char* >(frame);
+        Alloc* const stored = std::launder(reinterpret_cast< Alloc* >(p + allocator_offset(size, alignof(Alloc))));
+        block_allocator< Alloc > alloc(static_cast< Alloc&& >(*stored));
+        stored->~Alloc();
+        std::allocator_traits< block_allocator< Alloc > >::deallocate(alloc, static_cast< std::max_align_t* >(frame), blocks< Alloc >(size));
+    }
+
+    static void deallocate_global(void* frame, std::size_t) noexcept
+    {
+        ::operator delete(frame);
+    }
+
+public:
+    static void* allocate(std::size_t size)
+    {
+        void* const frame = ::operator new(function_offset(size) + sizeof(deallocate_function));
+        ::new (static_cast< unsigned char* >(frame) + function_offset(size)) deallocate_function(&deallocate_global);
+        return frame;
+    }
+
+    template< typename Alloc >
+    static void* allocate(std::size_t size, Alloc const& a)
+    {
+        static_assert(alignof(Alloc) <= alignment, "coroutine frame allocator is over-aligned");
+
+        block_allocator< Alloc > alloc(a);
+        void* const frame = std::allocator_traits< block_allocator< Alloc > >::allocate(alloc, blocks< Alloc >(size));
+        unsigned char* const p = static_cast< unsigned char* >(frame);
+        ::new (p + function_offset(size)) deallocate_function(&deallocate_with< Alloc >);
+        ::new (p + allocator_offset(size, alignof(Alloc))) Alloc(a);
+        return frame;
+    }
+
+    static void deallocate(void* frame, std::size_t size) noexcept
+    {
+        unsigned char* const p = static_cast< unsigned char* >(frame);
+        const deallocate_function f = *std::launder(reinterpret_cast< deallocate_function* >(p + function_offset(size)));
+        f(frame, size);
+    }
+};
+
+template< typename T >
+class coroutine_generator_promise
+{
+public:
+    using value_type = typename std::remove_cv< typename std::remove_reference< T >::type >::type;
+
+    coroutine_generator< T > get_return_object() noexcept
+    {
+        return coroutine_generator< T >(std::coroutine_handle< coroutine_generator_promise >::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    std::suspend_always final_suspend() const noexcept { return {}; }
+
+    // The yielded value outlives the suspension of the coroutine
+    std::suspend_always yield_value(value_type const& value) noexcept
+    {
+        m_value = std::addressof(value);
+        return {};
+    }
+
+    void return_void() const noexcept {}
+
+    void unhandled_exception() noexcept
+    {
+        m_error = std::current_exception();
+    }
+
+    // Disallow co_await in generators
+    template< typename U >
+    std::suspend_never await_transform(U&&) = delete;
+
+    value_type const& value() const noexcept { return *m_value; }
+
+    void rethrow_if_failed()
+    {
+        if (m_error)
+        {
+            std::exception_ptr error = m_error;
+            m_error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Frames of coroutines taking std::allocator_arg_t and an allocator as their
+    // first parameters, or following the object parameter, are allocated with
+    // that allocator
+    template< typename Alloc, typename... Args >
+    static void* operator new(std::size_t size, std::allocator_arg_t, Alloc const& alloc, Args const&...)
+    {
+        return coroutine_frame_allocation::allocate(size, alloc);
+    }
+
+    template< typename Object, typename Alloc, typename... Args >
+    static void* operator new(std::size_t size, Object const&, std::allocator_arg_t, Alloc const& alloc, Args const&...)
+    {
+        return coroutine_frame_allocation::allocate(size, alloc);
+    }
+
+    static void* operator new(std::size_t size)
+    {
+        return coroutine_frame_allocation::allocate(size);
+    }
+
+    static void operator delete(void* frame, std::size_t size) noexcept
+    {
+        coroutine_frame_allocation::deallocate(frame, size);
+    }
+
+    // Counterparts of the allocator-aware operator new, which also release
+    // the frame with the deallocation function stored in it
+    template< typename Alloc, typename... Args >
+    static void operator delete(void* frame, std::size_t size, std::allocator_arg_t, Alloc const&, Args const&...) noexcept
+    {
+        coroutine_frame_allocation::deallocate(frame, size);
+    }
+
+    template< typename Object, typename Alloc, typename... Args >
+    static void operator delete(void* frame, std::size_t size, Object const&, std::allocator_arg_t, Alloc const&, Args const&...) noexcept
+    {
+        coroutine_frame_allocation::deallocate(frame, size);
+    }
+
+private:
+    value_type const* m_value = nullptr;
+    std::exception_ptr m_error;
+};
+
+template< typename T >
+class coroutine_generator_iterator :
+    public iterator_facade<
+        coroutine_generator_iterator< T >,
+        typename coroutine_generator_promise< T >::value_type,
+        single_pass_traversal_tag,
+        typename coroutine_generator_promise< T >::value_type const&
+    >
+{
+    friend class iterators::iterator_core_access;
+    friend class coroutine_generator< T >;
+
+private:
+    using super_t = iterator_facade<
+        coroutine_generator_iterator< T >,
+        typename coroutine_generator_promise< T >::value_type,
+        single_pass_traversal_tag,
+        typename coroutine_generator_promise< T >::value_type const&
+    >;
+    using handle_type = std::coroutine_handle< coroutine_generator_promise< T > >;
+
+public:
+    using reference = typename super_t::reference;
+
+    // Constructs the end iterator
+    coroutine_generator_iterator() = default;
+
+private:
+    explicit coroutine_generator_iterator(handle_type h) noexcept :
+        m_handle(h)
+    {}
+
+    reference dereference() const
+    {
+        BOOST_ASSERT(!is_end());
+        return m_handle.promise().value();
+    }
+
+    void increment()
+    {
+        BOOST_ASSERT(!is_end());
+        m_handle.resume();
+        if (m_handle.done())
+            m_handle.promise().rethrow_if_failed();
+    }
+
+    bool equal(coroutine_generator_iterator const& that) const noexcept
+    {
+        return is_end() == that.is_end();
+    }
+
+    bool is_end() const noexcept
+    {
+        return !m_handle || m_handle.done();
+    }
+
+private:
+    handle_type m_handle;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// coroutine_generator class definition
+//
+// The return type of coroutines that produce a sequence of values of
+// type T with co_yield. The generator owns the coroutine, and its
+// iterator, which is a single pass iterator, resumes the coroutine
+// on each increment.
+//
+// Coroutines that take std::allocator_arg as their first parameter,
+// followed by an allocator, have their frame allocated with a copy of
+// that allocator, which is kept in the frame for its deallocation.
+// This allows coroutine frames to be allocated from an arena or a pool.
+//
+template< typename T >
+class coroutine_generator
+{
+    friend class detail::coroutine_generator_promise< T >;
+
+public:
+    using promise_type = detail::coroutine_generator_promise< T >;
+    using iterator = detail::coroutine_generator_iterator< T >;
+    using value_type = typename promise_type::value_type;
+
+    coroutine_generator() = default;
+
+    coroutine_generator(coroutine_generator&& that) noexcept :
+        m_handle(std::exchange(that.m_handle, nullptr))
+    {}
+
+    coroutine_generator& operator=(coroutine_generator&& that) noexcept
+    {
+        if (this != &that)
+        {
+            if (m_handle)
+                m_handle.destroy();
+            m_handle = std::exchange(that.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~coroutine_generator()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    // Starts the coroutine and returns the iterator to the first value. Must be called once.
+    iterator begin()
+    {
+        if (m_handle)
+        {
+            m_handle.resume();
+            if (m_handle.done())
+                m_handle.promise().rethrow_if_failed();
+        }
+        return iterator(m_handle);
+    }
+
+    iterator end() const noexcept { return iterator(); }
+
+private:
+    explicit coroutine_generator(std::coroutine_handle< promise_type > h) noexcept :
+        m_handle(h)
+    {}
+
+private:
+    std::coroutine_handle< promise_type > m_handle;
+};
+
+} // namespace iterators
+
+using iterators::coroutine_generator;
+
+} // namespace boost
+
+#endif // defined(BOOST_ITERATOR_HAS_COROUTINE_GENERATOR)
+
+#endif // BOOST_ITERATOR_COROUTINE_GENERATOR_HPP_INCLUDED_
@@ -5,10 +5,14 @@
 #ifndef BOOST_ITERATOR_COUNTING_ITERATOR_DWA200348_HPP
 #define BOOST_ITERATOR_COUNTING_ITERATOR_DWA200348_HPP
 
+#include <array>
+#include <cstddef>
 #include <limits>
+#include <utility>
 #include <type_traits>
 
 #include <boost/config.hpp>
+#include <boost/assert.hpp>
 #include <boost/core/use_default.hpp>
 #include <boost/detail/numeric_traits.hpp>
 #include <boost/iterator/iterator_adaptor.hpp>
@@ -183,6 +187,37 @@ public:
     {
     }
 
+    // Returns the W consecutive values starting from the current one.
+    // The loop is trivially vectorizable, so that the values can be
+    // loaded into a vector register without a broadcast and add.
+    template<
+        std::size_t W,
+        bool Requires = detail::is_numeric< Incrementable >::value,
+        typename = typename std::enable_if< Requires >::type
+    >
+    std::array< Incrementable, W > batch() const noexcept
+    {
+        std::array< Incrementable, W > values;
+        const Incrementable first = this->base();
+        for (std::size_t i = 0u; i < W; ++i)
+            values[i] = static_cast< Incrementable >(first + static_cast< Incrementable >(i));
+        return values;
+    }
+
+    // Returns the W consecutive values starting from the current one
+    // and advances the iterator past them
+    template<
+        std::size_t W,
+        bool Requires = detail::is_numeric< Incrementable >::value,
+        typename = typename std::enable_if< Requires >::type
+    >
+    std::array< Incrementable, W > next_batch() noexcept
+    {
+        const std::array< Incrementable, W > values = this->template batch< W >();
+        this->base_reference() = static_cast< Incrementable >(this->base_reference() + static_cast< Incrementable >(W));
+        return values;
+    }
+
 private:
     reference dereference() const
     {
@@ -210,10 +245,270 @@ inline counting_iterator< Incrementable > make_counting_iterator(Incrementable x
     return counting_iterator< Incrementable >(x);
 }
 
+template< typename Incrementable, typename Step = use_default >
+class strided_counting_iterator;
+
+namespace detail {
+
+// The integral type of the value of a step
+template< typename Step >
+struct strided_step_value
+{
+    using type = Step;
+};
+
+template< typename T, T Value >
+struct strided_step_value< std::integral_constant< T, Value > >
+{
+    using type = T;
+};
+
+// Tells whether the integral step can be converted to To without changing its value
+template< typename To, typename From >
+constexpr bool is_lossless_step(From step) noexcept
+{
+    return static_cast< From >(static_cast< To >(step)) == step &&
+        (static_cast< To >(step) < static_cast< To >(0)) == (step < static_cast< From >(0));
+}
+
+template< typename To, typename Step >
+struct is_lossless_constant_step :
+    public std::true_type
+{
+};
+
+template< typename To, typename T, T Value >
+struct is_lossless_constant_step< To, std::integral_constant< T, Value > > :
+    public std::integral_constant< bool, is_lossless_step< To >(Value) >
+{
+};
+
+template< typename Incrementable, typename Step >
+struct strided_counting_iterator_base
+{
+    static_assert(std::is_integral< Incrementable >::value && !std::is_same< Incrementable, bool >::value,
+        "strided_counting_iterator requires an integral type");
+
+    using difference = typename numeric_difference< Incrementable >::type;
+
+    // By default, the step is a runtime value of the difference type
+    using step_type = detail::if_default_t< Step, difference >;
+
+    static_assert(std::is_integral< typename strided_step_value< step_type >::type >::value,
+        "strided_counting_iterator requires an integral step");
+    static_assert(is_lossless_constant_step< difference, step_type >::value,
+        "strided_counting_iterator step is not representable in the difference type");
+
+    using type = iterator_adaptor<
+        strided_counting_iterator< Incrementable, Step >,
+        Incrementable,
+#ifndef BOOST_ITERATOR_REF_CONSTNESS_KILLS_WRITABILITY
+        const
+#endif
+        Incrementable,
+        random_access_traversal_tag,
+        Incrementable const&,
+        difference
+    >;
+};
+
+// Storage of a runtime step
+template< typename Step >
+class strided_step_holder
+{
+public:
+    strided_step_holder() = default;
+    explicit strided_step_holder(Step step) noexcept : m_step(step) {}
+
+    static constexpr Step default_step() noexcept { return static_cast< Step >(1); }
+    Step get_step() const noexcept { return m_step; }
+
+private:
+    Step m_step = default_step();
+};
+
+// Compile time steps are not stored
+template< typename T, T Value >
+class strided_step_holder< std::integral_constant< T, Value > >
+{
+public:
+    strided_step_holder() = default;
+    explicit strided_step_holder(std::integral_constant< T, Value >) noexcept {}
+
+    static constexpr std::integral_constant< T, Value > default_step() noexcept { return std::integral_constant< T, Value >(); }
+    static constexpr T get_step() noexcept { return Value; }
+};
+
+// Runtime steps passed to the factories use the default step type
+template< typename Step >
+struct strided_step_parameter
+{
+    using type = use_default;
+};
+
+template< typename T, T Value >
+struct strided_step_parameter< std::integral_constant< T, Value > >
+{
+    using type = std::integral_constant< T, Value >;
+};
+
+template< typename Step >
+using strided_step_parameter_t = typename strided_step_parameter< Step >::type;
+
+// Converts a runtime step passed to the factories to the step type, which must represent it exactly
+template< typename To, typename From >
+inline To strided_step_cast(From step) noexcept
+{
+    static_assert(std::is_integral< From >::value && !std::is_same< From, bool >::value,
+        "strided_counting_iterator requires an integral step");
+    BOOST_ASSERT_MSG(is_lossless_step< To >(step), "strided_counting_iterator step is not representable in the difference type");
+    return static_cast< To >(step);
+}
+
+template< typename To, typename T, T Value >
+inline To strided_step_cast(std::integral_constant< T, Value > step) noexcept
+{
+    return step;
+}
+
+// Adds n to x with the wrap-around of the unsigned counterpart of Integer,
+// so that stepping past the end of the range of Integer is well defined
+template< typename Integer, typename Difference >
+inline Integer wrapping_add(Integer x, Difference n) noexcept
+{
+    using unsigned_type = typename std::make_unsigned< Integer >::type;
+    return static_cast< Integer >(static_cast< unsigned_type >(static_cast< unsigned_type >(x) + static_cast< unsigned_type >(n)));
+}
+
+// Division rounding the quotient away from zero
+template< typename T >
+inline T div_round_away(T x, T y) noexcept
+{
+    T q = x / y;
+    if (x % y != 0)
+        q += ((x < 0) == (y < 0)) ? 1 : -1;
+    return q;
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// strided_counting_iterator class definition
+//
+// Counts from the initial value in steps of a given size, which can
+// be a runtime value, or a compile time constant when Step is
+// a std::integral_constant. The distance between two iterators is
+// the number of steps between their initial values, which must differ
+// by a multiple of the step, plus the difference of their numbers of
+// steps. Counting the steps keeps the distance exact for an end iterator
+// that steps past the largest value of the type, whose value wraps around.
+//
+template< typename Incrementable, typename Step >
+class strided_counting_iterator :
+    public detail::strided_counting_iterator_base< Incrementable, Step >::type,
+    private detail::strided_step_holder< typename detail::strided_counting_iterator_base< Incrementable, Step >::step_type >
+{
+    friend class iterator_core_access;
+
+private:
+    using super_t = typename detail::strided_counting_iterator_base< Incrementable, Step >::type;
+    using step_base = detail::strided_step_holder< typename detail::strided_counting_iterator_base< Incrementable, Step >::step_type >;
+
+public:
+    using reference = typename super_t::reference;
+    using difference_type = typename super_t::difference_type;
+    using step_type = typename detail::strided_counting_iterator_base< Incrementable, Step >::step_type;
+
+    strided_counting_iterator() = default;
+
+    explicit strided_counting_iterator(Incrementable x, step_type step = step_base::default_step()) :
+        super_t(x),
+        step_base(step)
+    {
+        BOOST_ASSERT(this->step() != 0);
+    }
+
+    difference_type step() const noexcept { return static_cast< difference_type >(step_base::get_step()); }
+
+private:
+    reference dereference() const
+    {
+        return this->base_reference();
+    }
+
+    void increment()
+    {
+        this->base_reference() = detail::wrapping_add(this->base_reference(), step());
+        ++m_steps;
+    }
+
+    void decrement()
+    {
+        this->base_reference() = detail::wrapping_add(this->base_reference(), -step());
+        --m_steps;
+    }
+
+    void advance(difference_type n)
+    {
+        this->base_reference() = detail::wrapping_add(this->base_reference(), n * step());
+        m_steps += n;
+    }
+
+    difference_type distance_to(strided_counting_iterator const& y) const
+    {
+        BOOST_ASSERT(step() == y.step());
+        const difference_type n = static_cast< difference_type >(boost::detail::numeric_distance(initial_value(), y.initial_value()));
+        BOOST_ASSERT(n % step() == 0);
+        return n / step() + (y.m_steps - m_steps);
+    }
+
+    // The value the iterator was constructed with, which is recovered
+    // exactly by the wrapping arithmetic
+    Incrementable initial_value() const noexcept
+    {
+        return detail::wrapping_add(this->base(), -(m_steps * step()));
+    }
+
+private:
+    // Number of steps taken from the initial value
+    difference_type m_steps = 0;
+};
+
+template< typename Incrementable, typename Step >
+inline strided_counting_iterator< Incrementable, detail::strided_step_parameter_t< Step > >
+make_strided_counting_iterator(Incrementable x, Step step)
+{
+    using iterator = strided_counting_iterator< Incrementable, detail::strided_step_parameter_t< Step > >;
+    return iterator(x, detail::strided_step_cast< typename iterator::step_type >(step));
+}
+
+// Returns the iterators over the values of [first, last) counted from
+// first in steps of the given size. The end iterator is snapped to the
+// next multiple of the step past the range, so that it can be reached
+// by stepping from the beginning, even if its value wraps around.
+template< typename Incrementable, typename Step >
+inline std::pair<
+    strided_counting_iterator< Incrementable, detail::strided_step_parameter_t< Step > >,
+    strided_counting_iterator< Incrementable, detail::strided_step_parameter_t< Step > >
+>
+make_strided_counting_range(Incrementable first, Incrementable last, Step step)
+{
+    using iterator = strided_counting_iterator< Incrementable, detail::strided_step_parameter_t< Step > >;
+    using difference_type = typename iterator::difference_type;
+    iterator begin(first, detail::strided_step_cast< typename iterator::step_type >(step));
+    const difference_type n = detail::div_round_away(
+        static_cast< difference_type >(boost::detail::numeric_distance(first, last)), begin.step());
+    return std::make_pair(begin, begin + (n > 0 ? n : 0));
+}
+
 } // namespace iterators
 
 using iterators::counting_iterator;
 using iterators::make_counting_iterator;
+using iterators::strided_counting_iterator;
+using iterators::make_strided_counting_iterator;
+using iterators::make_strided_counting_range;
 
 } // namespace boost
 
@@ -0,0 +1,361 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_FD_OUTPUT_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_FD_OUTPUT_ITERATOR_HPP_INCLUDED_
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_HAS_UNISTD_H)
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace iterators {
+
+/////////////////////////////////////////////////////////////////////
+//
+// fd_sink class definition
+//
+// Buffers the bytes written to a POSIX file descriptor in a number of
+// page-aligned buffers, and writes all the filled buffers with a single
+// writev call when the last buffer is full. The file descriptor is not
+// owned by the sink, and its file status flags are not modified.
+//
+// If the file descriptor was opened with O_DIRECT, the buffers are
+// written directly, bypassing the page cache; the file must then be
+// seekable, not opened with O_APPEND, and its offset must be a multiple
+// of the page size. Since all buffers but the last one are full when they
+// are written, only flush() may have to write an unaligned tail. It writes
+// the tail padded to a whole page, truncates the file to the end of the
+// data, and moves the file offset back to the start of that page, which
+// is kept in the buffers and written again, aligned, with the next data.
+//
+// Errors are reported by throwing std::system_error. The buffered data
+// is discarded when a write fails.
+//
+class fd_sink
+{
+public:
+    static constexpr std::size_t default_buffer_size = 65536u;
+    static constexpr std::size_t default_buffer_count = 4u;
+
+    // Allocates buffer_count buffers of buffer_size bytes, rounded up to a multiple of the page size
+    explicit fd_sink(int fd, std::size_t buffer_size = default_buffer_size, std::size_t buffer_count = default_buffer_count) :
+        m_fd(fd), m_page_size(page_size()), m_direct(is_direct(fd))
+    {
+        BOOST_ASSERT(buffer_count > 0u);
+        m_buffer_size = (buffer_size + m_page_size - 1u) / m_page_size * m_page_size;
+        if (m_buffer_size == 0u)
+            m_buffer_size = m_page_size;
+        if (buffer_count > static_cast< std::size_t >(IOV_MAX))
+            buffer_count = static_cast< std::size_t >(IOV_MAX);
+
+        m_iov.resize(buffer_count);
+        m_buffers.reserve(buffer_count);
+        try
+        {
+            for (std::size_t i = 0u; i < buffer_count; ++i)
+            {
+                void* p = nullptr;
+                if (::posix_memalign(&p, m_page_size, m_buffer_size) != 0)
+                    throw std::bad_alloc();
+                m_buffers.push_back(static_cast< unsigned char* >(p));
+            }
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    fd_sink(fd_sink const&) = delete;
+    fd_sink& operator=(fd_sink const&) = delete;
+
+    // Writes the buffered data, ignoring errors
+    ~fd_sink()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+        release();
+    }
+
+    void write(void const* data, std::size_t size)
+    {
+        unsigned char const* p = static_cast< unsigned char const* >(data);
+        while (size > 0u)
+        {
+            if (m_used == m_buffer_size)
+            {
+                if (m_current + 1u == m_buffers.size())
+                    write_buffers();
+                else
+                {
+                    ++m_current;
+                    m_used = 0u;
+                }
+            }
+
+            const std::size_t n = size < m_buffer_size - m_used ? size : m_buffer_size - m_used;
+            std::memcpy(m_buffers[m_current] + m_used, p, n);
+            m_used += n;
+            p += n;
+            size -= n;
+        }
+    }
+
+    void flush()
+    {
+        if (pending() > 0u)
+            write_buffers();
+    }
+
+    // Returns the number of buffered bytes that are not written yet
+    std::size_t pending() const noexcept { return m_current * m_buffer_size + m_used - m_written_tail; }
+
+    int native_handle() const noexcept { return m_fd; }
+    std::size_t buffer_size() const noexcept { return m_buffer_size; }
+    std::size_t buffer_count() const noexcept { return m_buffers.size(); }
+    bool is_direct() const noexcept { return m_direct; }
+
+private:
+    static std::size_t page_size() noexcept
+    {
+        const long size = ::sysconf(_SC_PAGESIZE);
+        return size > 0 ? static_cast< std::size_t >(size) : 4096u;
+    }
+
+    static bool is_direct(int fd) noexcept
+    {
+#if defined(O_DIRECT)
+        const int flags = ::fcntl(fd, F_GETFL);
+        return flags != -1 && (flags & O_DIRECT) != 0;
+#else
+        (void)fd;
+        return false;
+#endif
+    }
+
+    static void throw_error(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    void release() noexcept
+    {
+        for (unsigned char* p : m_buffers)
+            std::free(p);
+        m_buffers.clear();
+    }
+
+    void reset() noexcept
+    {
+        m_current = 0u;
+        m_used = 0u;
+        m_written_tail = 0u;
+    }
+
+    // Writes the filled buffers and the partially filled one. In direct mode,
+    // the unaligned end of the last buffer is written by write_direct_tail.
+    void write_buffers()
+    {
+        std::size_t count = 0u;
+        for (; count < m_current; ++count)
+        {
+            m_iov[count].iov_base = m_buffers[count];
+            m_iov[count].iov_len = m_buffer_size;
+        }
+
+        const std::size_t aligned = m_direct ? m_used / m_page_size * m_page_size : m_used;
+        if (aligned > 0u)
+        {
+            m_iov[count].iov_base = m_buffers[m_current];
+            m_iov[count].iov_len = aligned;
+            ++count;
+        }
+
+        try
+        {
+            write_all(m_iov.data(), count);
+            if (aligned < m_used)
+                write_direct_tail(aligned);
+            else
+                reset();
+        }
+        catch (...)
+        {
+            reset();
+            throw;
+        }
+    }
+
+    // Writes the end of the last buffer from offset, padded to a page,
+    // truncates the file to the end of the data and moves the file offset
+    // back to the start of the page, which is moved to the first buffer
+    void write_direct_tail(std::size_t offset)
+    {
+        unsigned char* const page = m_buffers[m_current] + offset;
+        const std::size_t tail = m_used - offset;
+        std::memset(page + tail, 0, m_page_size - tail);
+
+        struct ::iovec iov;
+        iov.iov_base = page;
+        iov.iov_len = m_page_size;
+        write_all(&iov, 1u);
+
+        const ::off_t end = ::lseek(m_fd, 0, SEEK_CUR);
+        if (end < 0)
+            throw_error("fd_sink: failed to get the file offset");
+        const ::off_t start = end - static_cast< ::off_t >(m_page_size);
+        if (::ftruncate(m_fd, start + static_cast< ::off_t >(tail)) != 0)
+            throw_error("fd_sink: failed to truncate the file");
+        if (::lseek(m_fd, start, SEEK_SET) < 0)
+            throw_error("fd_sink: failed to set the file offset");
+
+        std::memmove(m_buffers[0], page, tail);
+        m_current = 0u;
+        m_used = tail;
+        m_written_tail = tail;
+    }
+
+    void write_all(struct ::iovec* iov, std::size_t count)
+    {
+        while (count > 0u)
+        {
+            const ::ssize_t written = ::writev(m_fd, iov, static_cast< int >(count));
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw_error("fd_sink: write failed");
+            }
+
+            // Skip the written buffers after a partial write
+            std::size_t n = static_cast< std::size_t >(written);
+            while (count > 0u && n >= iov->iov_len)
+            {
+                n -= iov->iov_len;
+                ++iov;
+                --count;
+            }
+            if (count > 0u)
+            {
+                iov->iov_base = static_cast< unsigned char* >(iov->iov_base) + n;
+                iov->iov_len -= n;
+            }
+        }
+    }
+
+private:
+    int m_fd;
+    std::size_t m_page_size;
+    std::size_t m_buffer_size = 0u;
+    bool m_direct;
+    std::vector< unsigned char* > m_buffers;
+    std::vector< struct ::iovec > m_iov;
+    // Index of the buffer being filled and the number of bytes used in it
+    std::size_t m_current = 0u;
+    std::size_t m_used = 0u;
+    // Number of bytes at the start of the first buffer that were written
+    // as the padded tail of the file in direct mode
+    std::size_t m_written_tail = 0u;
+};
+
+/////////////////////////////////////////////////////////////////////
+//
+// fd_output_iterator class definition
+//
+// An output iterator that writes the object representation of values
+// of a trivially copyable type T to an fd_sink, which must outlive
+// the iterator.
+//
+template< typename T >
+class fd_output_iterator
+{
+    static_assert(std::is_trivially_copyable< T >::value, "fd_output_iterator requires a trivially copyable value type");
+
+private:
+    class output_proxy
+    {
+    public:
+        explicit output_proxy(fd_sink& sink) noexcept :
+            m_sink(sink)
+        {}
+
+        output_proxy const& operator=(T const& value) const
+        {
+            m_sink.write(&value, sizeof(T));
+            return *this;
+        }
+
+        output_proxy(output_proxy const& that) = default;
+        output_proxy& operator=(output_proxy const&) = delete;
+
+    private:
+        fd_sink& m_sink;
+    };
+
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    fd_output_iterator() = default;
+
+    explicit fd_output_iterator(fd_sink& sink) noexcept :
+        m_sink(&sink)
+    {}
+
+    output_proxy operator*() const { return output_proxy(*m_sink); }
+    fd_output_iterator& operator++() { return *this; }
+    fd_output_iterator& operator++(int) { return *this; }
+
+    fd_sink& sink() const noexcept { return *m_sink; }
+
+private:
+    fd_sink* m_sink = nullptr;
+};
+
+template< typename T >
+inline fd_output_iterator< T > make_fd_output_iterator(fd_sink& sink) noexcept
+{
+    return fd_output_iterator< T >(sink);
+}
+
+} // namespace iterators
+
+using iterators::fd_sink;
+using iterators::fd_output_iterator;
+using iterators::make_fd_output_iterator;
+
+} // namespace boost
+
+#endif // defined(BOOST_HAS_UNISTD_H)
+
+#endif // BOOST_ITERATOR_FD_OUTPUT_ITERATOR_HPP_INCLUDED_
@@ -7,10 +7,15 @@
 #ifndef BOOST_FILTER_ITERATOR_23022003THW_HPP
 #define BOOST_FILTER_ITERATOR_23022003THW_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <type_traits>
 
+#include <boost/core/bit.hpp>
 #include <boost/core/use_default.hpp>
 #include <boost/core/empty_value.hpp>
+#include <boost/mp11/utility.hpp>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/enable_if_convertible.hpp>
@@ -38,6 +43,74 @@ using filter_iterator_base_t = iterator_adaptor<
     >::type
 >;
 
+// Type of the mask returned by a batch predicate
+template< typename Predicate, typename T >
+using batch_mask_t = decltype(Predicate::batch_size, std::declval< Predicate& >().batch_mask(std::declval< T const* >()));
+
+template< typename Predicate, typename T, bool = mp11::mp_valid< batch_mask_t, Predicate, T >::value >
+struct is_batch_predicate_impl :
+    public std::false_type
+{};
+
+template< typename Predicate, typename T >
+struct is_batch_predicate_impl< Predicate, T, true > :
+    public std::integral_constant<
+        bool,
+        std::is_convertible< batch_mask_t< Predicate, T >, std::uint64_t >::value &&
+            (Predicate::batch_size > 0u) && (Predicate::batch_size <= 64u)
+    >
+{};
+
+// The trait checks if the predicate can test a batch of elements at once.
+// Batch predicates are only used with pointers, and must provide
+// a batch_size constant no greater than 64 and a batch_mask member
+// function that returns a mask with bit i set if the predicate is
+// satisfied for the i-th element of the batch.
+template< typename Predicate, typename Iterator >
+struct is_batch_predicate :
+    public std::false_type
+{};
+
+template< typename Predicate, typename T >
+struct is_batch_predicate< Predicate, T* > :
+    public is_batch_predicate_impl< Predicate, T >
+{};
+
+template< typename Predicate, typename Iterator >
+inline void skip_rejected(Predicate& pred, Iterator& it, Iterator const& end, std::false_type)
+{
+    while (it != end && !pred(*it))
+        ++it;
+}
+
+// Skips whole batches of rejected elements, then finds the first
+// accepted element in the batch from the mask
+template< typename Predicate, typename Iterator >
+inline void skip_rejected(Predicate& pred, Iterator& it, Iterator const& end, std::true_type)
+{
+    constexpr std::ptrdiff_t batch_size = static_cast< std::ptrdiff_t >(Predicate::batch_size);
+    while (end - it >= batch_size)
+    {
+        const std::uint64_t mask = static_cast< std::uint64_t >(pred.batch_mask(it));
+        if (mask != 0u)
+        {
+            it += boost::core::countr_zero(mask);
+            return;
+        }
+
+        it += batch_size;
+    }
+
+    detail::skip_rejected(pred, it, end, std::false_type());
+}
+
+// Advances the iterator to the first element in [it, end) that satisfies the predicate
+template< typename Predicate, typename Iterator >
+inline void skip_rejected(Predicate& pred, Iterator& it, Iterator const& end)
+{
+    detail::skip_rejected(pred, it, end, is_batch_predicate< Predicate, Iterator >());
+}
+
 } // namespace detail
 
 template< typename Predicate, typename Iterator >
@@ -124,8 +197,7 @@ private:
 
     void satisfy_predicate()
     {
-        while (this->base() != m_storage.m_end && !m_storage.predicate()(*this->base()))
-            ++(this->base_reference());
+        detail::skip_rejected(m_storage.predicate(), this->base_reference(), m_storage.m_end);
     }
 
 private:
@@ -0,0 +1,191 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_FILTER_VIEW_HPP_INCLUDED_
+#define BOOST_ITERATOR_FILTER_VIEW_HPP_INCLUDED_
+
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/enable_if_convertible.hpp>
+#include <boost/iterator/filter_iterator.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename Predicate, typename Iterator >
+class filter_view;
+
+template< typename Predicate, typename Iterator >
+class filter_view_iterator;
+
+namespace detail {
+
+template< typename Predicate, typename Iterator >
+using filter_view_iterator_base_t = iterator_adaptor<
+    filter_view_iterator< Predicate, Iterator >,
+    Iterator,
+    use_default,
+    typename std::conditional<
+        std::is_convertible<
+            iterator_traversal_t< Iterator >,
+            random_access_traversal_tag
+        >::value,
+        bidirectional_traversal_tag,
+        use_default
+    >::type
+>;
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// filter_view_iterator class definition
+//
+// Iterator of a filter_view. Instead of storing the predicate and the
+// end of the underlying range, like filter_iterator does, it refers to
+// the view that owns them, so it is only one pointer larger than the
+// underlying iterator.
+//
+template< typename Predicate, typename Iterator >
+class filter_view_iterator :
+    public detail::filter_view_iterator_base_t< Predicate, Iterator >
+{
+    using super_t = detail::filter_view_iterator_base_t< Predicate, Iterator >;
+
+    friend class iterator_core_access;
+    friend class filter_view< Predicate, Iterator >;
+
+    template< typename, typename >
+    friend class filter_view_iterator;
+
+public:
+    using view_type = filter_view< Predicate, Iterator >;
+
+    filter_view_iterator() = default;
+
+    template< typename OtherIterator, typename = enable_if_convertible_t< OtherIterator, Iterator > >
+    filter_view_iterator(filter_view_iterator< Predicate, OtherIterator > const& other) :
+        super_t(other.base()), m_view(other.m_view)
+    {}
+
+    view_type const& view() const noexcept { return *m_view; }
+
+private:
+    filter_view_iterator(view_type const* view, Iterator it) :
+        super_t(static_cast< Iterator&& >(it)), m_view(view)
+    {}
+
+    void increment()
+    {
+        ++(this->base_reference());
+        detail::skip_rejected(m_view->predicate(), this->base_reference(), m_view->base_end());
+    }
+
+    void decrement()
+    {
+        while (!m_view->predicate()(*--(this->base_reference()))) {}
+    }
+
+private:
+    view_type const* m_view = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////
+//
+// filter_view class definition
+//
+// A range of the elements of [first, last) that satisfy a predicate.
+// The view stores the predicate and the end of the underlying range
+// once for all of its iterators. The end iterator of the view is
+// positioned at the end of the underlying range and acts as the
+// sentinel; iterators are compared by their underlying iterators only.
+//
+// The view must outlive the iterators obtained from it. The predicate
+// is always invoked on a const object.
+//
+template< typename Predicate, typename Iterator >
+class filter_view :
+    private boost::empty_value< Predicate >
+{
+    using predicate_base = boost::empty_value< Predicate >;
+
+public:
+    using iterator = filter_view_iterator< Predicate, Iterator >;
+    using const_iterator = iterator;
+    using base_iterator = Iterator;
+
+    filter_view(Predicate pred, Iterator first, Iterator last) :
+        predicate_base(boost::empty_init_t{}, static_cast< Predicate&& >(pred)),
+        m_first(static_cast< Iterator&& >(first)),
+        m_last(static_cast< Iterator&& >(last))
+    {}
+
+    template< bool Requires = std::is_class< Predicate >::value, typename = typename std::enable_if< Requires >::type >
+    filter_view(Iterator first, Iterator last) :
+        predicate_base(boost::empty_init_t{}),
+        m_first(static_cast< Iterator&& >(first)),
+        m_last(static_cast< Iterator&& >(last))
+    {}
+
+    Predicate const& predicate() const noexcept { return predicate_base::get(); }
+    Iterator const& base_begin() const noexcept { return m_first; }
+    Iterator const& base_end() const noexcept { return m_last; }
+
+    // Returns the iterator to the first element that satisfies the predicate
+    iterator begin() const
+    {
+        Iterator it = m_first;
+        detail::skip_rejected(predicate(), it, m_last);
+        return iterator(this, static_cast< Iterator&& >(it));
+    }
+
+    iterator end() const
+    {
+        return iterator(this, m_last);
+    }
+
+    // Returns the iterator to the first element at or after it that satisfies the predicate
+    iterator find(Iterator it) const
+    {
+        detail::skip_rejected(predicate(), it, m_last);
+        return iterator(this, static_cast< Iterator&& >(it));
+    }
+
+    bool empty() const { return begin() == end(); }
+
+private:
+    Iterator m_first;
+    Iterator m_last;
+};
+
+template< typename Predicate, typename Iterator >
+inline filter_view< Predicate, Iterator > make_filter_view(Predicate pred, Iterator first, Iterator last)
+{
+    return filter_view< Predicate, Iterator >(static_cast< Predicate&& >(pred), static_cast< Iterator&& >(first), static_cast< Iterator&& >(last));
+}
+
+template< typename Predicate, typename Iterator >
+inline typename std::enable_if<
+    std::is_class< Predicate >::value,
+    filter_view< Predicate, Iterator >
+>::type make_filter_view(Iterator first, Iterator last)
+{
+    return filter_view< Predicate, Iterator >(static_cast< Iterator&& >(first), static_cast< Iterator&& >(last));
+}
+
+} // namespace iterators
+
+using iterators::filter_view;
+using iterators::filter_view_iterator;
+using iterators::make_filter_view;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_FILTER_VIEW_HPP_INCLUDED_
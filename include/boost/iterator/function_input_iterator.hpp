@@ -9,6 +9,8 @@
 #ifndef BOOST_ITERATOR_FUNCTION_INPUT_ITERATOR_HPP_INCLUDED_
 #define BOOST_ITERATOR_FUNCTION_INPUT_ITERATOR_HPP_INCLUDED_
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -23,6 +25,9 @@ namespace iterators {
 template< typename Function, typename Input >
 class function_input_iterator;
 
+template< typename Function, typename Value, typename Input, std::size_t BufferSize = 64u >
+class buffered_function_input_iterator;
+
 namespace detail {
 
 template< typename Function, typename Input >
@@ -143,6 +148,187 @@ inline function_input_iterator< Function*, Input > make_function_input_iterator(
     return function_input_iterator< Function*, Input >(f, state);
 }
 
+namespace detail {
+
+// Holds a pointer to a function object, or a function pointer
+template< typename Function, bool IsFunctionPointer = detail::conjunction<
+    std::is_pointer< Function >,
+    std::is_function< typename std::remove_pointer< Function >::type >
+>::value >
+class bulk_function_holder
+{
+protected:
+    using function_arg_type = Function&;
+
+    explicit bulk_function_holder(function_arg_type f) noexcept : m_f(std::addressof(f)) {}
+
+    Function* function_pointer() const noexcept { return m_f; }
+
+private:
+    Function* m_f;
+};
+
+template< typename Function >
+class bulk_function_holder< Function, true >
+{
+protected:
+    using function_arg_type = Function;
+
+    explicit bulk_function_holder(function_arg_type f) noexcept : m_f(f) {}
+
+    Function function_pointer() const noexcept { return m_f; }
+
+private:
+    Function m_f;
+};
+
+// The buffer shared by the copies of a buffered_function_input_iterator,
+// along with the position of the next value in it
+template< typename Value, std::size_t BufferSize >
+struct bulk_input_buffer
+{
+    // The copies of a single pass iterator are not used concurrently,
+    // so the copies are counted without atomic operations
+    std::size_t refs = 1u;
+    // BufferSize or more if the buffer must be refilled before reading,
+    // in which case the values up to the position are skipped
+    std::size_t pos = BufferSize;
+    std::array< Value, BufferSize > values;
+};
+
+template< typename Function, typename Value, typename Input, std::size_t BufferSize >
+using buffered_function_input_iterator_facade_base_t = iterator_facade<
+    buffered_function_input_iterator< Function, Value, Input, BufferSize >,
+    Value,
+    single_pass_traversal_tag,
+    Value const&
+>;
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// buffered_function_input_iterator class definition
+//
+// An input iterator over values produced in bulk by a function called
+// as f(Value* first, std::size_t n), which must fill [first, first + n).
+// The values are generated BufferSize at a time into a buffer, which is
+// then read without further calls to the function. The buffer and the read
+// position are allocated on construction and shared by the copies of the
+// iterator, so that copying the iterator only increments a non-atomic count,
+// and incrementing any copy advances all of them, as for other single pass
+// iterators. As with function_input_iterator, the Input state counts the
+// increments and determines the equality of iterators.
+//
+template< typename Function, typename Value, typename Input, std::size_t BufferSize >
+class buffered_function_input_iterator :
+    public detail::buffered_function_input_iterator_facade_base_t< Function, Value, Input, BufferSize >,
+    private detail::bulk_function_holder< Function >
+{
+    static_assert(BufferSize > 0u, "buffered_function_input_iterator requires a non-empty buffer");
+
+    friend class iterator_core_access;
+
+private:
+    using base_type = detail::buffered_function_input_iterator_facade_base_t< Function, Value, Input, BufferSize >;
+    using function_base = detail::bulk_function_holder< Function >;
+    using function_arg_type = typename function_base::function_arg_type;
+    using buffer_type = detail::bulk_input_buffer< Value, BufferSize >;
+
+public:
+    using reference = typename base_type::reference;
+
+    static constexpr std::size_t buffer_size = BufferSize;
+
+public:
+    buffered_function_input_iterator(function_arg_type f, Input state) :
+        function_base(f), m_state(state), m_buffer(new buffer_type)
+    {}
+
+    buffered_function_input_iterator(buffered_function_input_iterator const& that) noexcept(std::is_nothrow_copy_constructible< Input >::value) :
+        function_base(that), m_state(that.m_state), m_buffer(that.m_buffer)
+    {
+        ++m_buffer->refs;
+    }
+
+    buffered_function_input_iterator& operator=(buffered_function_input_iterator const& that) noexcept(std::is_nothrow_copy_assignable< Input >::value)
+    {
+        m_state = that.m_state;
+        function_base::operator=(that);
+        ++that.m_buffer->refs;
+        release();
+        m_buffer = that.m_buffer;
+        return *this;
+    }
+
+    ~buffered_function_input_iterator()
+    {
+        release();
+    }
+
+    std::size_t buffered() const noexcept
+    {
+        return m_buffer->pos < BufferSize ? BufferSize - m_buffer->pos : 0u;
+    }
+
+private:
+    void increment()
+    {
+        ++m_buffer->pos;
+        ++m_state;
+    }
+
+    reference dereference() const
+    {
+        buffer_type& buffer = *m_buffer;
+        if (buffer.pos >= BufferSize)
+            refill(buffer);
+        return buffer.values[buffer.pos];
+    }
+
+    bool equal(buffered_function_input_iterator const& other) const
+    {
+        return this->function_pointer() == other.function_pointer() && m_state == other.m_state;
+    }
+
+    // Generates buffers until the one holding the current position
+    void refill(buffer_type& buffer) const
+    {
+        do
+        {
+            (*this->function_pointer())(buffer.values.data(), BufferSize);
+            buffer.pos -= BufferSize;
+        }
+        while (buffer.pos >= BufferSize);
+    }
+
+    void release() noexcept
+    {
+        if (--m_buffer->refs == 0u)
+            delete m_buffer;
+    }
+
+private:
+    Input m_state;
+    buffer_type* m_buffer;
+};
+
+template< typename Function, typename Value, typename Input, std::size_t BufferSize >
+constexpr std::size_t buffered_function_input_iterator< Function, Value, Input, BufferSize >::buffer_size;
+
+// Usage: make_buffered_function_input_iterator< Value >(f, state)
+template< typename Value, std::size_t BufferSize = 64u, typename Function, typename Input >
+inline buffered_function_input_iterator< Function, Value, Input, BufferSize > make_buffered_function_input_iterator(Function& f, Input state)
+{
+    return buffered_function_input_iterator< Function, Value, Input, BufferSize >(f, state);
+}
+
+template< typename Value, std::size_t BufferSize = 64u, typename Function, typename Input >
+inline buffered_function_input_iterator< Function*, Value, Input, BufferSize > make_buffered_function_input_iterator(Function* f, Input state)
+{
+    return buffered_function_input_iterator< Function*, Value, Input, BufferSize >(f, state);
+}
+
 struct infinite
 {
     infinite& operator++() { return *this; }
@@ -155,6 +341,8 @@ struct infinite
 
 using iterators::function_input_iterator;
 using iterators::make_function_input_iterator;
+using iterators::buffered_function_input_iterator;
+using iterators::make_buffered_function_input_iterator;
 using iterators::infinite;
 
 } // namespace boost
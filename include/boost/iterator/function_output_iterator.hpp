@@ -13,7 +13,12 @@
 
 #include <cstddef>
 #include <iterator>
+#include <new>
 #include <type_traits>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/core/empty_value.hpp>
 
 namespace boost {
 namespace iterators {
@@ -79,10 +84,208 @@ inline function_output_iterator< UnaryFunction > make_function_output_iterator(U
     return function_output_iterator< UnaryFunction >(f);
 }
 
+/////////////////////////////////////////////////////////////////////
+//
+// buffered_function_output_iterator class definition
+//
+// An output iterator that collects the assigned elements in an inline
+// buffer of Capacity elements, and passes them to the sink as
+// a contiguous range by calling sink(first, last), with first and last
+// being of type T const*. The sink is called when the buffer is full,
+// when flush() is called and when the iterator is destroyed.
+//
+// Copying an iterator first flushes the elements buffered in the source,
+// so that every element is passed to the sink exactly once. Moving an
+// iterator transfers the buffered elements to the new iterator.
+//
+template< typename Sink, typename T, std::size_t Capacity = 64u >
+class buffered_function_output_iterator :
+    private boost::empty_value< Sink >
+{
+    static_assert(Capacity > 0u, "buffered_function_output_iterator requires a non-empty buffer");
+
+private:
+    using sink_base = boost::empty_value< Sink >;
+
+    class output_proxy
+    {
+    public:
+        explicit output_proxy(buffered_function_output_iterator& it) noexcept :
+            m_it(it)
+        {}
+
+        template< typename U >
+        typename std::enable_if<
+            !std::is_same< typename std::remove_cv< typename std::remove_reference< U >::type >::type, output_proxy >::value,
+            output_proxy const&
+        >::type operator=(U&& value) const
+        {
+            m_it.push(static_cast< U&& >(value));
+            return *this;
+        }
+
+        output_proxy(output_proxy const& that) = default;
+        output_proxy& operator=(output_proxy const&) = delete;
+
+    private:
+        buffered_function_output_iterator& m_it;
+    };
+
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    static constexpr std::size_t capacity = Capacity;
+
+    template<
+        bool Requires = std::is_class< Sink >::value,
+        typename = typename std::enable_if< Requires >::type
+    >
+    buffered_function_output_iterator() :
+        sink_base(boost::empty_init_t{})
+    {}
+
+    explicit buffered_function_output_iterator(Sink const& sink) :
+        sink_base(boost::empty_init_t{}, sink)
+    {}
+
+    buffered_function_output_iterator(buffered_function_output_iterator const& that) :
+        sink_base(boost::empty_init_t{}, flushed_sink(that))
+    {}
+
+    buffered_function_output_iterator(buffered_function_output_iterator&& that) :
+        sink_base(boost::empty_init_t{}, static_cast< Sink&& >(that.sink_base::get()))
+    {
+        take(that);
+    }
+
+    buffered_function_output_iterator& operator=(buffered_function_output_iterator const& that)
+    {
+        if (this != &that)
+        {
+            flush();
+            that.flush_pending();
+            sink_base::get() = that.sink();
+        }
+        return *this;
+    }
+
+    buffered_function_output_iterator& operator=(buffered_function_output_iterator&& that)
+    {
+        if (this != &that)
+        {
+            flush();
+            sink_base::get() = static_cast< Sink&& >(that.sink_base::get());
+            take(that);
+        }
+        return *this;
+    }
+
+    // Flushes the buffered elements. Exceptions thrown by the sink are suppressed.
+    ~buffered_function_output_iterator()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+        clear();
+    }
+
+    output_proxy operator*() { return output_proxy(*this); }
+    buffered_function_output_iterator& operator++() { return *this; }
+    buffered_function_output_iterator& operator++(int) { return *this; }
+
+    // Passes the buffered elements to the sink. If the sink throws, the elements are kept in the buffer.
+    void flush()
+    {
+        flush_pending();
+    }
+
+    // Returns the number of buffered elements
+    std::size_t pending() const noexcept { return m_size; }
+
+    Sink const& sink() const noexcept { return sink_base::get(); }
+    Sink& sink() noexcept { return sink_base::get(); }
+
+private:
+    T* data() const noexcept
+    {
+        return static_cast< T* >(static_cast< void* >(m_storage));
+    }
+
+    static Sink const& flushed_sink(buffered_function_output_iterator const& that)
+    {
+        that.flush_pending();
+        return that.sink();
+    }
+
+    template< typename U >
+    void push(U&& value)
+    {
+        // The buffer may still be full if the sink has thrown
+        if (m_size == Capacity)
+            flush();
+        ::new (static_cast< void* >(data() + m_size)) T(static_cast< U&& >(value));
+        if (++m_size == Capacity)
+            flush();
+    }
+
+    // Copying a const iterator needs to flush its buffer, which is logically
+    // not a part of its value
+    void flush_pending() const
+    {
+        if (m_size > 0u)
+        {
+            T const* const first = data();
+            const_cast< Sink& >(sink_base::get())(first, first + m_size);
+            clear();
+        }
+    }
+
+    void clear() const noexcept
+    {
+        T* const first = data();
+        for (std::size_t i = 0u; i < m_size; ++i)
+            first[i].~T();
+        m_size = 0u;
+    }
+
+    void take(buffered_function_output_iterator& that)
+    {
+        T* const first = data();
+        T* const source = that.data();
+        for (; m_size < that.m_size; ++m_size)
+            ::new (static_cast< void* >(first + m_size)) T(static_cast< T&& >(source[m_size]));
+        that.clear();
+    }
+
+private:
+    mutable std::size_t m_size = 0u;
+    alignas(T) mutable unsigned char m_storage[Capacity * sizeof(T)];
+};
+
+template< typename Sink, typename T, std::size_t Capacity >
+constexpr std::size_t buffered_function_output_iterator< Sink, T, Capacity >::capacity;
+
+// Usage: make_buffered_function_output_iterator< T >(sink)
+template< typename T, std::size_t Capacity = 64u, typename Sink >
+inline buffered_function_output_iterator< Sink, T, Capacity > make_buffered_function_output_iterator(Sink const& sink)
+{
+    return buffered_function_output_iterator< Sink, T, Capacity >(sink);
+}
+
 } // namespace iterators
 
 using iterators::function_output_iterator;
 using iterators::make_function_output_iterator;
+using iterators::buffered_function_output_iterator;
+using iterators::make_buffered_function_output_iterator;
 
 } // namespace boost
 
@@ -0,0 +1,205 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_GALLOPING_FILTER_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_GALLOPING_FILTER_ITERATOR_HPP_INCLUDED_
+
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/core/use_default.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/iterator_traits.hpp>
+#include <boost/iterator/enable_if_convertible.hpp>
+#include <boost/iterator/detail/if_default.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename Predicate, typename Iterator, typename Compare = use_default >
+class galloping_filter_iterator;
+
+namespace detail {
+
+// Default ordering of the elements and skip hints
+struct gallop_less
+{
+    template< typename T, typename U >
+    bool operator()(T const& left, U const& right) const
+    {
+        return left < right;
+    }
+};
+
+template< typename Predicate, typename Iterator, typename Compare >
+using galloping_filter_iterator_base_t = iterator_adaptor<
+    galloping_filter_iterator< Predicate, Iterator, Compare >,
+    Iterator,
+    use_default,
+    typename std::conditional<
+        std::is_convertible<
+            iterator_traversal_t< Iterator >,
+            random_access_traversal_tag
+        >::value,
+        bidirectional_traversal_tag,
+        use_default
+    >::type
+>;
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// galloping_filter_iterator class definition
+//
+// A filter iterator over a sorted range that, when an element is
+// rejected, asks the predicate for a skip hint: a value such that
+// no element ordered before it satisfies the predicate. The iterator
+// then moves to the first element not ordered before the hint, using
+// an exponential search followed by a binary search over random access
+// ranges, and a linear search otherwise.
+//
+template< typename Predicate, typename Iterator, typename Compare >
+class galloping_filter_iterator :
+    public detail::galloping_filter_iterator_base_t< Predicate, Iterator, Compare >
+{
+    friend class iterator_core_access;
+
+    template< typename, typename, typename >
+    friend class galloping_filter_iterator;
+
+private:
+    using super_t = detail::galloping_filter_iterator_base_t< Predicate, Iterator, Compare >;
+    using compare_type = detail::if_default_t< Compare, detail::gallop_less >;
+
+    // Storage class to leverage EBO, when possible
+    struct storage :
+        private boost::empty_value< Predicate, 0 >,
+        private boost::empty_value< compare_type, 1 >
+    {
+        using predicate_base = boost::empty_value< Predicate, 0 >;
+        using compare_base = boost::empty_value< compare_type, 1 >;
+
+        Iterator m_end;
+
+        storage() = default;
+
+        template< typename Pred, typename Comp, typename Iter >
+        storage(Pred&& pred, Comp&& comp, Iter&& end) :
+            predicate_base(boost::empty_init_t{}, static_cast< Pred&& >(pred)),
+            compare_base(boost::empty_init_t{}, static_cast< Comp&& >(comp)),
+            m_end(static_cast< Iter&& >(end))
+        {
+        }
+
+        Predicate& predicate() noexcept { return predicate_base::get(); }
+        Predicate const& predicate() const noexcept { return predicate_base::get(); }
+        compare_type const& compare() const noexcept { return compare_base::get(); }
+    };
+
+public:
+    using difference_type = typename super_t::difference_type;
+
+    galloping_filter_iterator() = default;
+
+    galloping_filter_iterator(Predicate f, Iterator x, Iterator end = Iterator(), compare_type comp = compare_type()) :
+        super_t(static_cast< Iterator&& >(x)),
+        m_storage(static_cast< Predicate&& >(f), static_cast< compare_type&& >(comp), static_cast< Iterator&& >(end))
+    {
+        satisfy_predicate();
+    }
+
+    template< typename OtherIterator, typename = enable_if_convertible_t< OtherIterator, Iterator > >
+    galloping_filter_iterator(galloping_filter_iterator< Predicate, OtherIterator, Compare > const& t) :
+        super_t(t.base()), m_storage(t.m_storage.predicate(), t.m_storage.compare(), t.m_storage.m_end)
+    {}
+
+    Predicate predicate() const { return m_storage.predicate(); }
+    Iterator end() const { return m_storage.m_end; }
+
+private:
+    void increment()
+    {
+        ++(this->base_reference());
+        satisfy_predicate();
+    }
+
+    void decrement()
+    {
+        while (!m_storage.predicate()(*--(this->base_reference()))) {}
+    }
+
+    void satisfy_predicate()
+    {
+        Iterator& it = this->base_reference();
+        while (it != m_storage.m_end && !m_storage.predicate()(*it))
+        {
+            Iterator next = gallop(it, m_storage.predicate().skip_hint(*it),
+                std::is_convertible< iterator_traversal_t< Iterator >, random_access_traversal_tag >());
+            // The rejected element itself may not be ordered before the hint
+            if (next == it)
+                ++next;
+            it = static_cast< Iterator&& >(next);
+        }
+    }
+
+    // Returns the first element in [first, end) not ordered before the hint
+    template< typename Hint >
+    Iterator gallop(Iterator first, Hint const& hint, std::true_type) const
+    {
+        compare_type const& comp = m_storage.compare();
+        const difference_type size = m_storage.m_end - first;
+
+        // Elements at offsets up to lo are known to be ordered before the hint
+        difference_type lo = 0, hi = 1;
+        while (hi < size && comp(*(first + hi), hint))
+        {
+            lo = hi;
+            hi *= 2;
+        }
+
+        if (hi > size)
+            hi = size;
+
+        return std::lower_bound(first + lo, first + hi, hint, comp);
+    }
+
+    template< typename Hint >
+    Iterator gallop(Iterator first, Hint const& hint, std::false_type) const
+    {
+        compare_type const& comp = m_storage.compare();
+        while (first != m_storage.m_end && comp(*first, hint))
+            ++first;
+        return first;
+    }
+
+private:
+    storage m_storage;
+};
+
+template< typename Predicate, typename Iterator >
+inline galloping_filter_iterator< Predicate, Iterator > make_galloping_filter_iterator(Predicate f, Iterator x, Iterator end = Iterator())
+{
+    return galloping_filter_iterator< Predicate, Iterator >(static_cast< Predicate&& >(f), static_cast< Iterator&& >(x), static_cast< Iterator&& >(end));
+}
+
+template< typename Predicate, typename Iterator, typename Compare >
+inline galloping_filter_iterator< Predicate, Iterator, Compare > make_galloping_filter_iterator(Predicate f, Iterator x, Iterator end, Compare comp)
+{
+    return galloping_filter_iterator< Predicate, Iterator, Compare >(
+        static_cast< Predicate&& >(f), static_cast< Iterator&& >(x), static_cast< Iterator&& >(end), static_cast< Compare&& >(comp));
+}
+
+} // namespace iterators
+
+using iterators::galloping_filter_iterator;
+using iterators::make_galloping_filter_iterator;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_GALLOPING_FILTER_ITERATOR_HPP_INCLUDED_
@@ -85,11 +85,94 @@ inline generator_iterator< Generator > make_generator_iterator(Generator& gen)
     return generator_iterator< Generator >(std::addressof(gen));
 }
 
+template< typename Generator >
+class optional_generator_iterator;
+
+namespace detail {
+
+template< typename Generator >
+struct optional_generator_iterator_base
+{
+    // The optional-like result of the generator
+    using result_type = typename std::decay< decltype(std::declval< Generator& >()()) >::type;
+    using value_type = typename std::remove_cv< typename std::remove_reference< decltype(*std::declval< result_type& >()) >::type >::type;
+
+    using type = iterator_facade<
+        optional_generator_iterator< Generator >,
+        value_type,
+        single_pass_traversal_tag,
+        value_type const&
+    >;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// optional_generator_iterator class definition
+//
+// An input iterator over the values of a generator that returns an
+// optional-like object, such as boost::optional or std::optional.
+// The sequence ends with the first empty result, and the end iterator
+// is the default-constructed iterator, so that comparing iterators only
+// tests whether they hold a value.
+//
+template< typename Generator >
+class optional_generator_iterator :
+    public detail::optional_generator_iterator_base< Generator >::type
+{
+    friend class iterator_core_access;
+
+private:
+    using super_t = typename detail::optional_generator_iterator_base< Generator >::type;
+    using result_type = typename detail::optional_generator_iterator_base< Generator >::result_type;
+
+public:
+    // Constructs the end iterator
+    optional_generator_iterator() :
+        m_g(nullptr),
+        m_value()
+    {}
+
+    explicit optional_generator_iterator(Generator* g) :
+        m_g(g),
+        m_value((*m_g)())
+    {}
+
+private:
+    void increment()
+    {
+        m_value = (*m_g)();
+    }
+
+    typename super_t::reference dereference() const
+    {
+        return *m_value;
+    }
+
+    bool equal(optional_generator_iterator const& y) const
+    {
+        return !m_value == !y.m_value;
+    }
+
+private:
+    Generator* m_g;
+    result_type m_value;
+};
+
+template< typename Generator >
+inline optional_generator_iterator< Generator > make_optional_generator_iterator(Generator& gen)
+{
+    return optional_generator_iterator< Generator >(std::addressof(gen));
+}
+
 } // namespace iterators
 
 using iterators::generator_iterator;
 using iterators::generator_iterator_generator;
 using iterators::make_generator_iterator;
+using iterators::optional_generator_iterator;
+using iterators::make_optional_generator_iterator;
 
 } // namespace boost
 
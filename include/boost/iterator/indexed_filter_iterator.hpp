@@ -0,0 +1,320 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_INDEXED_FILTER_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_INDEXED_FILTER_ITERATOR_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/iterator_traits.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename Iterator >
+class filter_index;
+
+template< typename Iterator >
+class indexed_filter_iterator;
+
+namespace detail {
+
+template< typename Iterator >
+using indexed_filter_iterator_base_t = iterator_facade<
+    indexed_filter_iterator< Iterator >,
+    iterator_value_t< Iterator >,
+    random_access_traversal_tag,
+    iterator_reference_t< Iterator >,
+    iterator_difference_t< Iterator >
+>;
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// indexed_filter_iterator class definition
+//
+// Iterates over the elements selected by a filter_index. Unlike
+// filter_iterator, it is a random access iterator: advancing and
+// computing distances are done with the rank/select index instead
+// of evaluating the predicate.
+//
+template< typename Iterator >
+class indexed_filter_iterator :
+    public detail::indexed_filter_iterator_base_t< Iterator >
+{
+    using super_t = detail::indexed_filter_iterator_base_t< Iterator >;
+
+    friend class iterator_core_access;
+    friend class filter_index< Iterator >;
+
+public:
+    using difference_type = typename super_t::difference_type;
+    using reference = typename super_t::reference;
+    using size_type = std::size_t;
+
+    indexed_filter_iterator() = default;
+
+    // Returns the iterator to the current element in the underlying sequence
+    Iterator base() const { return m_index->base_begin() + static_cast< difference_type >(m_position); }
+
+    // Returns the number of selected elements before the current one
+    size_type rank() const noexcept { return m_rank; }
+
+    filter_index< Iterator > const& index() const noexcept { return *m_index; }
+
+private:
+    indexed_filter_iterator(filter_index< Iterator > const* index, size_type rank, size_type position) noexcept :
+        m_index(index), m_rank(rank), m_position(position)
+    {}
+
+    reference dereference() const
+    {
+        BOOST_ASSERT(m_rank < m_index->size());
+        return *base();
+    }
+
+    bool equal(indexed_filter_iterator const& other) const noexcept
+    {
+        BOOST_ASSERT(m_index == other.m_index);
+        return m_rank == other.m_rank;
+    }
+
+    // Finding the next selected element is usually cheaper than a select
+    void increment() noexcept
+    {
+        ++m_rank;
+        m_position = m_index->next_position(m_position + 1u);
+    }
+
+    void decrement() noexcept
+    {
+        --m_rank;
+        m_position = m_index->select(m_rank);
+    }
+
+    void advance(difference_type n) noexcept
+    {
+        m_rank = static_cast< size_type >(static_cast< difference_type >(m_rank) + n);
+        m_position = m_index->select(m_rank);
+    }
+
+    difference_type distance_to(indexed_filter_iterator const& other) const noexcept
+    {
+        BOOST_ASSERT(m_index == other.m_index);
+        return static_cast< difference_type >(other.m_rank) - static_cast< difference_type >(m_rank);
+    }
+
+private:
+    filter_index< Iterator > const* m_index = nullptr;
+    // Number of selected elements before the current one
+    size_type m_rank = 0u;
+    // Offset of the current element in the underlying sequence
+    size_type m_position = 0u;
+};
+
+/////////////////////////////////////////////////////////////////////
+//
+// filter_index class definition
+//
+// Evaluates a predicate once over a random access sequence and stores
+// the result as a bitmap with one bit per element. The bitmap is
+// augmented with the number of selected elements preceding every
+// 64-bit word (rank) and the word containing every 64th selected
+// element (select samples), so that the position of the n-th selected
+// element is found without scanning the bitmap.
+//
+// The sequence must not be modified in a way that changes the predicate
+// results while the index is in use, and the index must outlive the
+// iterators obtained from it. Since the base iterators are recreated
+// on every dereference, Iterator must not return references into
+// the iterator object itself.
+//
+template< typename Iterator >
+class filter_index
+{
+    static_assert(std::is_convertible< iterator_traversal_t< Iterator >, random_access_traversal_tag >::value,
+        "filter_index requires a random access iterator");
+
+    friend class indexed_filter_iterator< Iterator >;
+
+    static constexpr std::size_t word_bits = 64u;
+    static constexpr std::size_t select_sample_rate = 64u;
+
+public:
+    using iterator = indexed_filter_iterator< Iterator >;
+    using const_iterator = iterator;
+    using reference = iterator_reference_t< Iterator >;
+    using difference_type = iterator_difference_t< Iterator >;
+    using size_type = std::size_t;
+
+    template< typename Predicate >
+    filter_index(Predicate pred, Iterator first, Iterator last) :
+        m_first(first),
+        m_base_size(static_cast< size_type >(last - first)),
+        m_size(0u)
+    {
+        const size_type word_count = (m_base_size + word_bits - 1u) / word_bits;
+        m_words.resize(word_count, 0u);
+        m_ranks.resize(word_count, 0u);
+
+        size_type i = 0u;
+        for (size_type w = 0u; w < word_count; ++w)
+        {
+            m_ranks[w] = m_size;
+
+            std::uint64_t word = 0u;
+            const size_type n = (std::min)(word_bits, m_base_size - i);
+            for (size_type b = 0u; b < n; ++b, ++i, ++first)
+            {
+                if (pred(*first))
+                {
+                    if (m_size % select_sample_rate == 0u)
+                        m_samples.push_back(w);
+                    word |= static_cast< std::uint64_t >(1u) << b;
+                    ++m_size;
+                }
+            }
+            m_words[w] = word;
+        }
+    }
+
+    // Copying would invalidate the iterators referring to the index
+    filter_index(filter_index const&) = delete;
+    filter_index& operator=(filter_index const&) = delete;
+
+    // Returns the number of selected elements
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0u; }
+
+    // Returns the number of elements in the underlying sequence
+    size_type base_size() const noexcept { return m_base_size; }
+    Iterator base_begin() const { return m_first; }
+    Iterator base_end() const { return m_first + static_cast< difference_type >(m_base_size); }
+
+    iterator begin() const noexcept { return iterator(this, 0u, next_position(0u)); }
+    iterator end() const noexcept { return iterator(this, m_size, m_base_size); }
+
+    // Returns the n-th selected element
+    reference operator[](size_type n) const
+    {
+        BOOST_ASSERT(n < m_size);
+        return *(m_first + static_cast< difference_type >(select(n)));
+    }
+
+    // Returns true if the element at the given position in the underlying sequence is selected
+    bool test(size_type position) const noexcept
+    {
+        BOOST_ASSERT(position < m_base_size);
+        return ((m_words[position / word_bits] >> (position % word_bits)) & 1u) != 0u;
+    }
+
+    // Returns the number of selected elements before the given position in the underlying sequence
+    size_type rank(size_type position) const noexcept
+    {
+        BOOST_ASSERT(position <= m_base_size);
+        const size_type w = position / word_bits;
+        const size_type b = position % word_bits;
+        if (b == 0u)
+            return w < m_ranks.size() ? m_ranks[w] : m_size;
+        return m_ranks[w] + static_cast< size_type >(boost::core::popcount(m_words[w] & ((static_cast< std::uint64_t >(1u) << b) - 1u)));
+    }
+
+    // Returns the position in the underlying sequence of the n-th selected element,
+    // or base_size() if n is size()
+    size_type select(size_type n) const noexcept
+    {
+        BOOST_ASSERT(n <= m_size);
+        if (n == m_size)
+            return m_base_size;
+
+        // The word containing the n-th selected element is between the words
+        // of the surrounding samples, find the last one with rank not exceeding n
+        const size_type sample = n / select_sample_rate;
+        const size_type lo = m_samples[sample];
+        const size_type hi = sample + 1u < m_samples.size() ? m_samples[sample + 1u] + 1u : m_words.size();
+        const size_type w = static_cast< size_type >(
+            std::upper_bound(m_ranks.begin() + lo, m_ranks.begin() + hi, n) - m_ranks.begin()) - 1u;
+
+        return w * word_bits + select_in_word(m_words[w], n - m_ranks[w]);
+    }
+
+    // Returns the iterator to the first selected element at or after the given base iterator
+    iterator find(Iterator it) const
+    {
+        const size_type position = static_cast< size_type >(it - m_first);
+        return iterator(this, rank(position), next_position(position));
+    }
+
+private:
+    // Returns the position of the first selected element at or after the given position
+    size_type next_position(size_type position) const noexcept
+    {
+        size_type w = position / word_bits;
+        if (w >= m_words.size())
+            return m_base_size;
+
+        std::uint64_t word = m_words[w] & (~static_cast< std::uint64_t >(0u) << (position % word_bits));
+        while (word == 0u)
+        {
+            if (++w == m_words.size())
+                return m_base_size;
+            word = m_words[w];
+        }
+
+        return w * word_bits + static_cast< size_type >(boost::core::countr_zero(word));
+    }
+
+    // Returns the bit index of the n-th set bit in the word
+    static size_type select_in_word(std::uint64_t word, size_type n) noexcept
+    {
+        size_type offset = 0u;
+        while (true)
+        {
+            const size_type count = static_cast< size_type >(boost::core::popcount(word & 0xFFu));
+            if (n < count)
+                break;
+            n -= count;
+            word >>= 8u;
+            offset += 8u;
+        }
+
+        for (; n > 0u; --n)
+            word &= word - 1u;
+
+        return offset + static_cast< size_type >(boost::core::countr_zero(word));
+    }
+
+private:
+    Iterator m_first;
+    size_type m_base_size;
+    size_type m_size;
+    std::vector< std::uint64_t > m_words;
+    std::vector< size_type > m_ranks;
+    std::vector< size_type > m_samples;
+};
+
+template< typename Iterator >
+constexpr std::size_t filter_index< Iterator >::word_bits;
+template< typename Iterator >
+constexpr std::size_t filter_index< Iterator >::select_sample_rate;
+
+} // namespace iterators
+
+using iterators::indexed_filter_iterator;
+using iterators::filter_index;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_INDEXED_FILTER_ITERATOR_HPP_INCLUDED_
@@ -0,0 +1,220 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_INDEXED_ZIP_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_INDEXED_ZIP_ITERATOR_HPP_INCLUDED_
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/enable_if_convertible.hpp>
+#include <boost/iterator/detail/type_traits/conjunction.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename PointerTuple >
+class indexed_zip_iterator;
+
+/////////////////////////////////////////////////////////////////////
+//
+// zip_batch class definition
+//
+// A block of Width consecutive rows of zipped contiguous sequences,
+// represented as a tuple of pointers to the first element of the
+// block in each sequence.
+//
+template< std::size_t Width, typename PointerTuple >
+class zip_batch
+{
+    static_assert(Width > 0u, "zip_batch width must be positive");
+
+public:
+    // Number of rows in the batch
+    static constexpr std::size_t width = Width;
+
+    explicit zip_batch(PointerTuple const& pointers) noexcept :
+        m_pointers(pointers)
+    {}
+
+    static constexpr std::size_t size() noexcept { return Width; }
+
+    // Returns the tuple of pointers to the first elements of the batch
+    PointerTuple const& pointers() const noexcept { return m_pointers; }
+
+    // Returns the pointer to the first element of the batch in the I-th sequence
+    template< std::size_t I >
+    typename std::tuple_element< I, PointerTuple >::type column() const noexcept
+    {
+        return std::get< I >(m_pointers);
+    }
+
+private:
+    PointerTuple m_pointers;
+};
+
+template< std::size_t Width, typename PointerTuple >
+constexpr std::size_t zip_batch< Width, PointerTuple >::width;
+
+namespace detail {
+
+template< typename PointerTuple >
+struct indexed_zip_iterator_base;
+
+template< typename... Pointers >
+struct indexed_zip_iterator_base< std::tuple< Pointers... > >
+{
+    static_assert(sizeof...(Pointers) > 0u, "indexed_zip_iterator requires at least one pointer");
+    static_assert(detail::conjunction< std::is_pointer< Pointers >... >::value, "indexed_zip_iterator requires a tuple of pointers");
+
+    // Whether all sequences contain arithmetic types, which is required for batches.
+    using is_arithmetic = detail::conjunction< std::is_arithmetic< typename std::remove_pointer< Pointers >::type >... >;
+
+    // Reference type is the tuple of references to the pointed elements.
+    using reference = std::tuple< typename std::remove_pointer< Pointers >::type&... >;
+
+    // Value type is the same as reference type, like in zip_iterator.
+    using type = iterator_facade<
+        indexed_zip_iterator< std::tuple< Pointers... > >,
+        reference,
+        random_access_traversal_tag,
+        reference,
+        std::ptrdiff_t
+    >;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// indexed_zip_iterator class definition
+//
+// A zip iterator over contiguous sequences. Instead of moving every
+// member iterator, it keeps the base pointers fixed and moves a single
+// index shared by all sequences.
+//
+template< typename PointerTuple >
+class indexed_zip_iterator :
+    public detail::indexed_zip_iterator_base< PointerTuple >::type
+{
+    using super_t = typename detail::indexed_zip_iterator_base< PointerTuple >::type;
+
+    friend class iterator_core_access;
+
+    template< typename >
+    friend class indexed_zip_iterator;
+
+public:
+    using difference_type = typename super_t::difference_type;
+    using reference = typename super_t::reference;
+
+    indexed_zip_iterator() = default;
+
+    explicit indexed_zip_iterator(PointerTuple bases, difference_type index = 0) :
+        m_bases(bases), m_index(index)
+    {}
+
+    template< typename OtherPointerTuple, typename = enable_if_convertible_t< OtherPointerTuple, PointerTuple > >
+    indexed_zip_iterator(indexed_zip_iterator< OtherPointerTuple > const& other) :
+        m_bases(other.m_bases), m_index(other.m_index)
+    {}
+
+    // Returns the pointers to the beginning of the sequences
+    PointerTuple const& get_base_tuple() const noexcept { return m_bases; }
+
+    // Returns the current position relative to the base pointers
+    difference_type index() const noexcept { return m_index; }
+
+    // Returns the tuple of pointers to the current elements
+    PointerTuple get_iterator_tuple() const
+    {
+        return get_iterator_tuple_impl(mp11::make_index_sequence< std::tuple_size< PointerTuple >::value >());
+    }
+
+    // Returns the batch of Width rows starting at the current position.
+    // The caller is responsible for making sure that Width rows are
+    // available in every sequence.
+    template< std::size_t Width >
+    zip_batch< Width, PointerTuple > batch() const
+    {
+        static_assert(detail::indexed_zip_iterator_base< PointerTuple >::is_arithmetic::value,
+            "indexed_zip_iterator batches require sequences of arithmetic types");
+        return zip_batch< Width, PointerTuple >(get_iterator_tuple());
+    }
+
+    // Returns the batch of Width rows starting at the current position
+    // and advances the iterator past it.
+    template< std::size_t Width >
+    zip_batch< Width, PointerTuple > next_batch()
+    {
+        zip_batch< Width, PointerTuple > b = this->batch< Width >();
+        m_index += static_cast< difference_type >(Width);
+        return b;
+    }
+
+private:
+    template< std::size_t... Is >
+    PointerTuple get_iterator_tuple_impl(mp11::index_sequence< Is... >) const
+    {
+        return PointerTuple((std::get< Is >(m_bases) + m_index)...);
+    }
+
+    template< std::size_t... Is >
+    reference dereference_impl(mp11::index_sequence< Is... >) const
+    {
+        return reference(std::get< Is >(m_bases)[m_index]...);
+    }
+
+    reference dereference() const
+    {
+        return dereference_impl(mp11::make_index_sequence< std::tuple_size< PointerTuple >::value >());
+    }
+
+    // Iterators are only comparable if they refer to the same sequences,
+    // so only the index needs to be compared.
+    template< typename OtherPointerTuple >
+    bool equal(indexed_zip_iterator< OtherPointerTuple > const& other) const
+    {
+        BOOST_ASSERT(std::get< 0 >(m_bases) == std::get< 0 >(other.m_bases));
+        return m_index == other.m_index;
+    }
+
+    void increment() noexcept { ++m_index; }
+    void decrement() noexcept { --m_index; }
+    void advance(difference_type n) noexcept { m_index += n; }
+
+    template< typename OtherPointerTuple >
+    difference_type distance_to(indexed_zip_iterator< OtherPointerTuple > const& other) const
+    {
+        BOOST_ASSERT(std::get< 0 >(m_bases) == std::get< 0 >(other.m_bases));
+        return other.m_index - m_index;
+    }
+
+private:
+    PointerTuple m_bases;
+    difference_type m_index = 0;
+};
+
+template< typename... Pointers >
+inline indexed_zip_iterator< std::tuple< Pointers... > > make_indexed_zip_iterator(std::tuple< Pointers... > const& bases, std::ptrdiff_t index = 0)
+{
+    return indexed_zip_iterator< std::tuple< Pointers... > >(bases, index);
+}
+
+} // namespace iterators
+
+using iterators::zip_batch;
+using iterators::indexed_zip_iterator;
+using iterators::make_indexed_zip_iterator;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_INDEXED_ZIP_ITERATOR_HPP_INCLUDED_
@@ -0,0 +1,370 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_MULTI_COUNTING_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_MULTI_COUNTING_ITERATOR_HPP_INCLUDED_
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+
+namespace boost {
+namespace iterators {
+
+// Row-major order: the last dimension varies fastest
+struct row_major_order {};
+
+// Column-major order: the first dimension varies fastest
+struct column_major_order {};
+
+// Row-major order of tiles of the given sizes, each tile being traversed
+// in row-major order. Tiles on the upper edges of the box may be partial.
+template< std::size_t... TileSizes >
+struct tiled_order {};
+
+// Morton (Z) order, obtained by interleaving the bits of the indices.
+// The extents of the box must be powers of two.
+struct morton_order {};
+
+template< typename Index, std::size_t N, typename Order = row_major_order >
+class multi_counting_iterator;
+
+namespace detail {
+
+template< typename Order >
+struct multi_index_order;
+
+template<>
+struct multi_index_order< row_major_order >
+{
+    template< typename Difference, std::size_t N >
+    static void decode(std::array< Difference, N > const& extents, Difference pos, std::array< Difference, N >& offsets) noexcept
+    {
+        for (std::size_t d = N; d-- > 0u;)
+        {
+            offsets[d] = pos % extents[d];
+            pos /= extents[d];
+        }
+    }
+
+    // Advances the offsets by one element, assuming the result is within the box
+    template< typename Difference, std::size_t N >
+    static void increment(std::array< Difference, N > const& extents, std::array< Difference, N >& offsets) noexcept
+    {
+        std::size_t d = N - 1u;
+        while (++offsets[d] == extents[d] && d > 0u)
+            offsets[d--] = 0;
+    }
+};
+
+template<>
+struct multi_index_order< column_major_order >
+{
+    template< typename Difference, std::size_t N >
+    static void decode(std::array< Difference, N > const& extents, Difference pos, std::array< Difference, N >& offsets) noexcept
+    {
+        for (std::size_t d = 0u; d < N; ++d)
+        {
+            offsets[d] = pos % extents[d];
+            pos /= extents[d];
+        }
+    }
+
+    template< typename Difference, std::size_t N >
+    static void increment(std::array< Difference, N > const& extents, std::array< Difference, N >& offsets) noexcept
+    {
+        std::size_t d = 0u;
+        while (++offsets[d] == extents[d] && d < N - 1u)
+            offsets[d++] = 0;
+    }
+};
+
+template< std::size_t... TileSizes >
+struct multi_index_order< tiled_order< TileSizes... > >
+{
+    template< typename Difference, std::size_t N >
+    static void decode(std::array< Difference, N > const& extents, Difference pos, std::array< Difference, N >& offsets) noexcept
+    {
+        static_assert(sizeof...(TileSizes) == N, "tiled_order requires a tile size per dimension");
+        static constexpr std::size_t tiles[N] = { TileSizes... };
+
+        // Elements in the dimensions following the current one
+        std::array< Difference, N > inner;
+        inner[N - 1u] = 1;
+        for (std::size_t d = N - 1u; d > 0u; --d)
+            inner[d - 1u] = inner[d] * extents[d];
+
+        // Select the tile along each dimension in turn. All tiles along
+        // a dimension have the same number of elements, except the last one.
+        std::array< Difference, N > heights;
+        Difference outer = 1;
+        for (std::size_t d = 0u; d < N; ++d)
+        {
+            const Difference tile = static_cast< Difference >(tiles[d]);
+            const Difference k = pos / (outer * tile * inner[d]);
+            pos -= k * outer * tile * inner[d];
+            offsets[d] = k * tile;
+            heights[d] = extents[d] - offsets[d] < tile ? extents[d] - offsets[d] : tile;
+            outer *= heights[d];
+        }
+
+        // Row-major position within the tile
+        for (std::size_t d = N; d-- > 0u;)
+        {
+            offsets[d] += pos % heights[d];
+            pos /= heights[d];
+        }
+    }
+
+    template< typename Difference, std::size_t N >
+    static void increment(std::array< Difference, N > const& extents, std::array< Difference, N >& offsets) noexcept
+    {
+        static constexpr std::size_t tiles[N] = { TileSizes... };
+
+        // Move within the current tile in row-major order
+        for (std::size_t d = N; d-- > 0u;)
+        {
+            const Difference tile = static_cast< Difference >(tiles[d]);
+            const Difference tile_end = (offsets[d] / tile + 1) * tile;
+            if (++offsets[d] < (tile_end < extents[d] ? tile_end : extents[d]))
+                return;
+            offsets[d] -= (offsets[d] - 1) % tile + 1;
+        }
+
+        // Move to the next tile
+        for (std::size_t d = N; d-- > 0u;)
+        {
+            offsets[d] += static_cast< Difference >(tiles[d]);
+            if (offsets[d] < extents[d] || d == 0u)
+                return;
+            offsets[d] = 0;
+        }
+    }
+};
+
+template<>
+struct multi_index_order< morton_order >
+{
+    template< typename Difference, std::size_t N >
+    static void decode(std::array< Difference, N > const& extents, Difference pos, std::array< Difference, N >& offsets) noexcept
+    {
+        // Deal the bits of the position to the dimensions, starting from the last
+        // one, skipping the dimensions that have no more bits
+        offsets.fill(0);
+        for (Difference bit = 1; pos != 0; bit <<= 1)
+        {
+            for (std::size_t d = N; d-- > 0u && pos != 0;)
+            {
+                if (bit < extents[d])
+                {
+                    if ((pos & 1) != 0)
+                        offsets[d] |= bit;
+                    pos >>= 1;
+                }
+            }
+        }
+    }
+
+    template< typename Difference, std::size_t N >
+    static void increment(std::array< Difference, N > const& extents, std::array< Difference, N >& offsets) noexcept
+    {
+        // Add one to the interleaved number: clear the trailing ones and set the next zero bit
+        for (Difference bit = 1;; bit <<= 1)
+        {
+            for (std::size_t d = N; d-- > 0u;)
+            {
+                if (bit < extents[d])
+                {
+                    offsets[d] ^= bit;
+                    if ((offsets[d] & bit) != 0)
+                        return;
+                }
+            }
+        }
+    }
+};
+
+template< typename Index, std::size_t N >
+struct multi_counting_iterator_base
+{
+    static_assert(is_numeric< Index >::value, "multi_counting_iterator requires a numeric index type");
+    static_assert(N > 0u, "multi_counting_iterator requires at least one dimension");
+
+    using difference = typename numeric_difference< Index >::type;
+    using value_type = std::array< Index, N >;
+};
+
+template< typename Difference >
+inline bool is_power_of_two(Difference x) noexcept
+{
+    return x > 0 && (x & (x - 1)) == 0;
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// multi_counting_iterator class definition
+//
+// Counts the N-dimensional indices of the box [lower, upper) in the
+// given order. The iterator stores its linear position in the
+// traversal, so that it can be advanced and compared in constant time,
+// and the corresponding indices, which are updated incrementally when
+// stepping forward.
+//
+template< typename Index, std::size_t N, typename Order >
+class multi_counting_iterator :
+    public iterator_facade<
+        multi_counting_iterator< Index, N, Order >,
+        std::array< Index, N >,
+        random_access_traversal_tag,
+        std::array< Index, N > const&,
+        typename detail::multi_counting_iterator_base< Index, N >::difference
+    >
+{
+    friend class iterator_core_access;
+
+private:
+    using order_traits = detail::multi_index_order< Order >;
+    using offsets_type = std::array< typename detail::multi_counting_iterator_base< Index, N >::difference, N >;
+
+public:
+    using value_type = std::array< Index, N >;
+    using reference = value_type const&;
+    using difference_type = typename detail::multi_counting_iterator_base< Index, N >::difference;
+    using order_type = Order;
+
+    static constexpr std::size_t dimensions = N;
+
+    multi_counting_iterator() = default;
+
+    multi_counting_iterator(value_type const& lower, value_type const& upper, difference_type position = 0) :
+        m_lower(lower),
+        m_position(position)
+    {
+        constexpr bool is_morton = std::is_same< Order, morton_order >::value;
+        m_size = 1;
+        for (std::size_t d = 0u; d < N; ++d)
+        {
+            BOOST_ASSERT(!(upper[d] < lower[d]));
+            m_extents[d] = static_cast< difference_type >(boost::detail::numeric_distance(lower[d], upper[d]));
+            BOOST_ASSERT(!is_morton || detail::is_power_of_two(m_extents[d]));
+            m_size *= m_extents[d];
+        }
+        BOOST_ASSERT(position >= 0 && position <= m_size);
+        update();
+    }
+
+    // Returns the position of the iterator in the traversal order
+    difference_type position() const noexcept { return m_position; }
+    // Returns the number of elements in the box
+    difference_type size() const noexcept { return m_size; }
+    // Returns the lower bounds of the box
+    value_type const& lower() const noexcept { return m_lower; }
+    // Returns the upper bounds of the box
+    value_type upper() const noexcept
+    {
+        value_type upper;
+        for (std::size_t d = 0u; d < N; ++d)
+            upper[d] = static_cast< Index >(m_lower[d] + m_extents[d]);
+        return upper;
+    }
+
+private:
+    reference dereference() const
+    {
+        BOOST_ASSERT(m_position >= 0 && m_position < m_size);
+        return m_index;
+    }
+
+    bool equal(multi_counting_iterator const& that) const noexcept
+    {
+        return m_position == that.m_position;
+    }
+
+    void increment()
+    {
+        ++m_position;
+        if (m_position < m_size && m_position > 0)
+        {
+            order_traits::increment(m_extents, m_offsets);
+            for (std::size_t d = 0u; d < N; ++d)
+                m_index[d] = static_cast< Index >(m_lower[d] + m_offsets[d]);
+        }
+        else
+        {
+            update();
+        }
+    }
+
+    void decrement()
+    {
+        --m_position;
+        update();
+    }
+
+    void advance(difference_type n)
+    {
+        m_position += n;
+        update();
+    }
+
+    difference_type distance_to(multi_counting_iterator const& that) const noexcept
+    {
+        return that.m_position - m_position;
+    }
+
+    // Recomputes the indices from the position
+    void update()
+    {
+        if (m_position >= 0 && m_position < m_size)
+        {
+            order_traits::decode(m_extents, m_position, m_offsets);
+            for (std::size_t d = 0u; d < N; ++d)
+                m_index[d] = static_cast< Index >(m_lower[d] + m_offsets[d]);
+        }
+    }
+
+private:
+    value_type m_lower{};
+    offsets_type m_extents{};
+    difference_type m_size = 0;
+    difference_type m_position = 0;
+    offsets_type m_offsets{};
+    value_type m_index{};
+};
+
+template< typename Index, std::size_t N, typename Order >
+constexpr std::size_t multi_counting_iterator< Index, N, Order >::dimensions;
+
+// Returns the iterators over the indices of the box [lower, upper) in the given order
+template< typename Order = row_major_order, typename Index, std::size_t N >
+inline std::pair< multi_counting_iterator< Index, N, Order >, multi_counting_iterator< Index, N, Order > >
+make_multi_counting_range(std::array< Index, N > const& lower, std::array< Index, N > const& upper)
+{
+    using iterator = multi_counting_iterator< Index, N, Order >;
+    iterator first(lower, upper);
+    return std::make_pair(first, iterator(lower, upper, first.size()));
+}
+
+} // namespace iterators
+
+using iterators::row_major_order;
+using iterators::column_major_order;
+using iterators::tiled_order;
+using iterators::morton_order;
+using iterators::multi_counting_iterator;
+using iterators::make_multi_counting_range;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_MULTI_COUNTING_ITERATOR_HPP_INCLUDED_
@@ -0,0 +1,378 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_PREFETCHING_INPUT_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_PREFETCHING_INPUT_ITERATOR_HPP_INCLUDED_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/optional/optional.hpp>
+
+#if defined(__has_include)
+#if __has_include(<optional>)
+#include <optional>
+#endif
+#endif
+
+namespace boost {
+namespace iterators {
+
+template< typename Generator, std::size_t Capacity = 256u >
+class prefetching_input_iterator;
+
+namespace detail {
+
+// Assumed cache line size, used to pad the data of the producer and the consumer apart
+constexpr std::size_t prefetch_cache_line_size = 64u;
+
+// Number of times a thread yields while waiting for the ring before it blocks
+constexpr unsigned int prefetch_spin_count = 64u;
+
+// Generators returning a value produce an infinite sequence
+template< typename Result >
+struct prefetch_result_traits
+{
+    using value_type = Result;
+
+    static bool is_end(Result const&) noexcept { return false; }
+    static Result&& get(Result& r) noexcept { return static_cast< Result&& >(r); }
+};
+
+// Generators returning an optional end the sequence with an empty optional
+template< typename T >
+struct prefetch_result_traits< boost::optional< T > >
+{
+    using value_type = T;
+
+    static bool is_end(boost::optional< T > const& r) noexcept { return !r; }
+    static T&& get(boost::optional< T >& r) noexcept { return static_cast< T&& >(*r); }
+};
+
+#if defined(__cpp_lib_optional) && (__cpp_lib_optional >= 201606l)
+
+template< typename T >
+struct prefetch_result_traits< std::optional< T > >
+{
+    using value_type = T;
+
+    static bool is_end(std::optional< T > const& r) noexcept { return !r; }
+    static T&& get(std::optional< T >& r) noexcept { return static_cast< T&& >(*r); }
+};
+
+#endif // defined(__cpp_lib_optional) && (__cpp_lib_optional >= 201606l)
+
+/////////////////////////////////////////////////////////////////////
+//
+// Shared state of prefetching_input_iterator: the generator, which
+// is called on the producer thread, and a bounded single-producer,
+// single-consumer ring of the generated values.
+//
+// A thread that finds the ring empty or full yields a few times, then
+// blocks on a condition variable. The other thread only locks the mutex
+// to notify it when it sees the waiting flag, which is checked after
+// a full fence, so that either the notification is sent or the waiting
+// thread sees the update before it blocks.
+//
+template< typename Generator, std::size_t Capacity >
+class prefetch_state
+{
+    static_assert(Capacity > 1u && (Capacity & (Capacity - 1u)) == 0u, "prefetching_input_iterator capacity must be a power of two");
+
+public:
+    using result_traits = prefetch_result_traits< typename std::decay< decltype(std::declval< Generator& >()()) >::type >;
+    using value_type = typename result_traits::value_type;
+
+    explicit prefetch_state(Generator&& gen) :
+        m_gen(static_cast< Generator&& >(gen))
+    {
+        m_thread = std::thread([this]() { this->produce(); });
+    }
+
+    prefetch_state(prefetch_state const&) = delete;
+    prefetch_state& operator=(prefetch_state const&) = delete;
+
+    ~prefetch_state()
+    {
+        m_stop.store(true, std::memory_order_relaxed);
+        notify(m_producer_waiting);
+        m_thread.join();
+
+        for (std::size_t i = m_tail.load(std::memory_order_relaxed), n = m_head.load(std::memory_order_relaxed); i != n; ++i)
+            slot(i)->~value_type();
+    }
+
+    // Waits until a value is available. Returns false if the generator
+    // is exhausted, or rethrows the exception thrown by the generator.
+    bool wait_front()
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_cached_head)
+        {
+            wait(m_consumer_waiting, [this, tail]() { return this->is_front_ready(tail); });
+            if (tail == m_cached_head)
+            {
+                if (m_error)
+                {
+                    std::exception_ptr error = m_error;
+                    m_error = nullptr;
+                    std::rethrow_exception(error);
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    value_type const& front() noexcept
+    {
+        return *slot(m_tail.load(std::memory_order_relaxed));
+    }
+
+    void pop() noexcept
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        BOOST_ASSERT(tail != m_cached_head);
+        slot(tail)->~value_type();
+        m_tail.store(tail + 1u, std::memory_order_release);
+        notify(m_producer_waiting);
+    }
+
+private:
+    value_type* slot(std::size_t index) noexcept
+    {
+        return static_cast< value_type* >(static_cast< void* >(m_storage + (index & (Capacity - 1u)) * sizeof(value_type)));
+    }
+
+    // Returns true if a value is available at tail or the producer is done
+    bool is_front_ready(std::size_t tail) noexcept
+    {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+        if (tail != m_cached_head)
+            return true;
+
+        if (m_done.load(std::memory_order_acquire))
+        {
+            // Values may have been pushed between the two loads
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            return true;
+        }
+        return false;
+    }
+
+    // Returns true if a slot is free at head or the producer is asked to stop
+    bool is_slot_ready(std::size_t head) noexcept
+    {
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+        return head - m_cached_tail != Capacity || m_stop.load(std::memory_order_relaxed);
+    }
+
+    // Waits until ready() returns true, first by yielding, then by blocking
+    template< typename Predicate >
+    void wait(std::atomic< bool >& waiting, Predicate ready)
+    {
+        for (unsigned int i = 0u; i < prefetch_spin_count; ++i)
+        {
+            if (ready())
+                return;
+            std::this_thread::yield();
+        }
+
+        std::unique_lock< std::mutex > lock(m_mutex);
+        waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!ready())
+            m_cond.wait(lock);
+        waiting.store(false, std::memory_order_relaxed);
+    }
+
+    // Wakes up the other thread if it is blocked
+    void notify(std::atomic< bool > const& waiting)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed))
+        {
+            std::lock_guard< std::mutex > lock(m_mutex);
+            m_cond.notify_one();
+        }
+    }
+
+    void produce() noexcept
+    {
+        try
+        {
+            std::size_t head = m_head.load(std::memory_order_relaxed);
+            while (!m_stop.load(std::memory_order_relaxed))
+            {
+                auto result = m_gen();
+                if (result_traits::is_end(result))
+                    break;
+
+                // Wait for a free slot
+                if (head - m_cached_tail == Capacity)
+                {
+                    wait(m_producer_waiting, [this, head]() { return this->is_slot_ready(head); });
+                    if (head - m_cached_tail == Capacity)
+                        return;
+                }
+
+                new (slot(head)) value_type(result_traits::get(result));
+                m_head.store(++head, std::memory_order_release);
+                notify(m_consumer_waiting);
+            }
+        }
+        catch (...)
+        {
+            m_error = std::current_exception();
+        }
+        m_done.store(true, std::memory_order_release);
+        notify(m_consumer_waiting);
+    }
+
+private:
+    Generator m_gen;
+    std::thread m_thread;
+    std::exception_ptr m_error;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+
+    // The groups of members written by each thread are separated by padding
+    // rather than aligned, as std::make_shared does not support over-aligned
+    // types before C++17
+    unsigned char m_producer_padding[prefetch_cache_line_size];
+
+    // Written by the producer
+    std::atomic< std::size_t > m_head{ 0u };
+    std::size_t m_cached_tail = 0u;
+    std::atomic< bool > m_done{ false };
+    std::atomic< bool > m_producer_waiting{ false };
+
+    unsigned char m_consumer_padding[prefetch_cache_line_size];
+
+    // Written by the consumer
+    std::atomic< std::size_t > m_tail{ 0u };
+    std::size_t m_cached_head = 0u;
+    std::atomic< bool > m_stop{ false };
+    std::atomic< bool > m_consumer_waiting{ false };
+
+    unsigned char m_storage_padding[prefetch_cache_line_size];
+
+    alignas(value_type) unsigned char m_storage[Capacity * sizeof(value_type)];
+};
+
+template< typename Generator, std::size_t Capacity >
+using prefetching_input_iterator_facade_base_t = iterator_facade<
+    prefetching_input_iterator< Generator, Capacity >,
+    typename prefetch_state< Generator, Capacity >::value_type,
+    single_pass_traversal_tag,
+    typename prefetch_state< Generator, Capacity >::value_type const&
+>;
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// prefetching_input_iterator class definition
+//
+// An input iterator over the values of a generator that is run on
+// a separate producer thread. The values are passed through a bounded
+// lock-free ring buffer of Capacity elements, so that generating the
+// values overlaps with their consumption. If the generator returns
+// a boost::optional or std::optional, the sequence ends with the first
+// empty optional, otherwise the sequence is infinite.
+//
+// Copies of an iterator share the producer thread, which is stopped
+// and joined when the last copy is destroyed or reaches the end.
+//
+template< typename Generator, std::size_t Capacity >
+class prefetching_input_iterator :
+    public detail::prefetching_input_iterator_facade_base_t< Generator, Capacity >
+{
+    friend class iterator_core_access;
+
+private:
+    using super_t = detail::prefetching_input_iterator_facade_base_t< Generator, Capacity >;
+    using state_type = detail::prefetch_state< Generator, Capacity >;
+
+public:
+    using reference = typename super_t::reference;
+
+    static constexpr std::size_t capacity = Capacity;
+
+    // Constructs the end iterator
+    prefetching_input_iterator() = default;
+
+    // Starts the producer thread and waits for the first value
+    explicit prefetching_input_iterator(Generator gen) :
+        m_state(std::make_shared< state_type >(static_cast< Generator&& >(gen)))
+    {
+        if (!m_state->wait_front())
+            m_state.reset();
+    }
+
+private:
+    reference dereference() const
+    {
+        BOOST_ASSERT(m_state != nullptr);
+        return m_state->front();
+    }
+
+    void increment()
+    {
+        BOOST_ASSERT(m_state != nullptr);
+        m_state->pop();
+        bool available = false;
+        try
+        {
+            available = m_state->wait_front();
+        }
+        catch (...)
+        {
+            m_state.reset();
+            throw;
+        }
+
+        if (!available)
+            m_state.reset();
+    }
+
+    bool equal(prefetching_input_iterator const& that) const noexcept
+    {
+        return m_state == that.m_state;
+    }
+
+private:
+    std::shared_ptr< state_type > m_state;
+};
+
+template< typename Generator, std::size_t Capacity >
+constexpr std::size_t prefetching_input_iterator< Generator, Capacity >::capacity;
+
+template< std::size_t Capacity = 256u, typename Generator >
+inline prefetching_input_iterator< typename std::decay< Generator >::type, Capacity > make_prefetching_input_iterator(Generator&& gen)
+{
+    return prefetching_input_iterator< typename std::decay< Generator >::type, Capacity >(static_cast< Generator&& >(gen));
+}
+
+} // namespace iterators
+
+using iterators::prefetching_input_iterator;
+using iterators::make_prefetching_input_iterator;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_PREFETCHING_INPUT_ITERATOR_HPP_INCLUDED_
@@ -0,0 +1,153 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_PROJECTION_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_PROJECTION_ITERATOR_HPP_INCLUDED_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <boost/core/use_default.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/iterator/iterator_traits.hpp>
+#include <boost/iterator/enable_if_convertible.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename Iterator, typename MemberPtr, MemberPtr Member >
+class projection_iterator;
+
+namespace detail {
+
+template< typename MemberPtr >
+struct member_object_pointer_traits;
+
+template< typename T, typename C >
+struct member_object_pointer_traits< T C::* >
+{
+    using member_type = T;
+    using class_type = C;
+};
+
+template< typename Iterator, typename MemberPtr, MemberPtr Member >
+struct projection_iterator_base
+{
+    static_assert(std::is_member_object_pointer< MemberPtr >::value,
+        "projection_iterator requires a pointer to data member");
+    static_assert(std::is_lvalue_reference< iterator_reference_t< Iterator > >::value,
+        "projection_iterator requires an iterator that returns lvalue references");
+
+    // The object referred to by the underlying iterator
+    using object_type = typename std::remove_reference< iterator_reference_t< Iterator > >::type;
+
+    // The member inherits the constness of the object
+    using value_type = typename std::conditional<
+        std::is_const< object_type >::value,
+        typename member_object_pointer_traits< MemberPtr >::member_type const,
+        typename member_object_pointer_traits< MemberPtr >::member_type
+    >::type;
+
+    using type = iterator_adaptor<
+        projection_iterator< Iterator, MemberPtr, Member >,
+        Iterator,
+        value_type,
+        use_default,    // Leave the traversal category alone
+        value_type&
+    >;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// projection_iterator class definition
+//
+// An lvalue iterator over a data member of the objects referred to
+// by the underlying iterator. The member is selected at compile time,
+// so that dereferencing compiles to a single address computation.
+//
+// When the underlying iterator is a pointer, the projected members
+// form a strided sequence: consecutive members are stride bytes apart,
+// where stride is a compile time constant.
+//
+template< typename Iterator, typename MemberPtr, MemberPtr Member >
+class projection_iterator :
+    public detail::projection_iterator_base< Iterator, MemberPtr, Member >::type
+{
+    friend class iterator_core_access;
+
+private:
+    using super_t = typename detail::projection_iterator_base< Iterator, MemberPtr, Member >::type;
+    using object_type = typename detail::projection_iterator_base< Iterator, MemberPtr, Member >::object_type;
+
+public:
+    using reference = typename super_t::reference;
+    using pointer = typename super_t::pointer;
+
+    // Whether the projected members form a strided sequence in memory
+    static constexpr bool is_strided = std::is_pointer< Iterator >::value;
+
+    // Distance in bytes between consecutive projected members if the
+    // sequence is strided, otherwise zero
+    static constexpr std::size_t stride = is_strided ? sizeof(object_type) : 0u;
+
+    projection_iterator() = default;
+
+    explicit projection_iterator(Iterator const& x) :
+        super_t(x)
+    {}
+
+    template< typename OtherIterator, typename = enable_if_convertible_t< OtherIterator, Iterator > >
+    projection_iterator(projection_iterator< OtherIterator, MemberPtr, Member > const& other) :
+        super_t(other.base())
+    {}
+
+    // Returns the pointer to the member of the current object
+    pointer get_pointer() const
+    {
+        return std::addressof(this->dereference());
+    }
+
+private:
+    reference dereference() const
+    {
+        return (*this->base()).*Member;
+    }
+};
+
+template< typename Iterator, typename MemberPtr, MemberPtr Member >
+constexpr bool projection_iterator< Iterator, MemberPtr, Member >::is_strided;
+template< typename Iterator, typename MemberPtr, MemberPtr Member >
+constexpr std::size_t projection_iterator< Iterator, MemberPtr, Member >::stride;
+
+// Usage: make_projection_iterator< decltype(&S::x), &S::x >(it)
+template< typename MemberPtr, MemberPtr Member, typename Iterator >
+inline projection_iterator< Iterator, MemberPtr, Member > make_projection_iterator(Iterator const& it)
+{
+    return projection_iterator< Iterator, MemberPtr, Member >(it);
+}
+
+#if defined(__cpp_nontype_template_parameter_auto) && (__cpp_nontype_template_parameter_auto >= 201606l)
+
+// Usage: make_projection_iterator< &S::x >(it)
+template< auto Member, typename Iterator >
+inline projection_iterator< Iterator, decltype(Member), Member > make_projection_iterator(Iterator const& it)
+{
+    return projection_iterator< Iterator, decltype(Member), Member >(it);
+}
+
+#endif // defined(__cpp_nontype_template_parameter_auto) && (__cpp_nontype_template_parameter_auto >= 201606l)
+
+} // namespace iterators
+
+using iterators::projection_iterator;
+using iterators::make_projection_iterator;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_PROJECTION_ITERATOR_HPP_INCLUDED_
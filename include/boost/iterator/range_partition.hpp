@@ -0,0 +1,150 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_RANGE_PARTITION_HPP_INCLUDED_
+#define BOOST_ITERATOR_RANGE_PARTITION_HPP_INCLUDED_
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/iterator/iterator_traits.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+
+// Cache line size in bytes assumed by cache_line_granularity. The default
+// of 64 bytes is the cache line size of most current CPUs; it is fixed
+// rather than taken from std::hardware_destructive_interference_size,
+// which may differ between compilers and options, so that the subrange
+// boundaries do not change with them. Define the macro to override it.
+#if !defined(BOOST_ITERATOR_CACHE_LINE_SIZE)
+#define BOOST_ITERATOR_CACHE_LINE_SIZE 64u
+#endif
+
+namespace boost {
+namespace iterators {
+
+namespace detail {
+
+constexpr std::size_t partition_cache_line_size = BOOST_ITERATOR_CACHE_LINE_SIZE;
+
+} // namespace detail
+
+// Returns the number of objects of type T that fit in a cache line,
+// but at least 1. Using it as the partition granularity places all
+// subrange boundaries of a contiguous sequence of T at cache line
+// boundaries, provided that the sequence itself starts at one.
+template< typename T >
+constexpr std::size_t cache_line_granularity() noexcept
+{
+    return sizeof(T) < detail::partition_cache_line_size ? detail::partition_cache_line_size / sizeof(T) : 1u;
+}
+
+/////////////////////////////////////////////////////////////////////
+//
+// range_partition class definition
+//
+// Splits a random access range into a number of balanced subranges
+// of the same iterator type. Subranges are computed on demand in
+// constant time using the iterator's advance and distance operations.
+//
+template< typename Iterator >
+class range_partition
+{
+    static_assert(std::is_convertible< iterator_traversal_t< Iterator >, random_access_traversal_tag >::value,
+        "range_partition requires a random access iterator");
+
+public:
+    using iterator = Iterator;
+    using difference_type = iterator_difference_t< Iterator >;
+    using size_type = std::size_t;
+    using subrange = std::pair< Iterator, Iterator >;
+
+    // Splits [first, last) into at most parts subranges. Every subrange
+    // except the last one has a size that is a multiple of granularity,
+    // and the sizes of any two subranges differ by at most granularity.
+    // If the range has fewer than parts granules, counting the incomplete
+    // last one, fewer subranges are produced, so that none of them is empty.
+    range_partition(Iterator first, Iterator last, size_type parts, difference_type granularity = 1) :
+        m_first(first),
+        m_size(last - first),
+        m_granularity(granularity),
+        m_grains(0u),
+        m_parts(0u)
+    {
+        BOOST_ASSERT(m_size >= 0);
+        BOOST_ASSERT(parts > 0u);
+        BOOST_ASSERT(granularity > 0);
+
+        // Only complete granules are distributed, the incomplete one goes to the last subrange
+        m_grains = static_cast< size_type >(m_size / m_granularity);
+        const size_type all_grains = m_grains + (m_size % m_granularity != 0 ? 1u : 0u);
+        m_parts = parts < all_grains ? parts : all_grains;
+        if (m_parts == 0u)
+            m_parts = 1u;
+    }
+
+    // Returns the number of subranges
+    size_type size() const noexcept { return m_parts; }
+
+    // Returns the granularity of subrange boundaries
+    difference_type granularity() const noexcept { return m_granularity; }
+
+    // Returns the beginning of the whole range
+    Iterator begin() const { return m_first; }
+
+    // Returns the end of the whole range
+    Iterator end() const { return m_first + m_size; }
+
+    // Returns the i-th subrange
+    subrange operator[](size_type i) const
+    {
+        BOOST_ASSERT(i < m_parts);
+        return subrange(m_first + boundary(i), m_first + boundary(i + 1u));
+    }
+
+private:
+    // Offset of the beginning of the i-th subrange from the beginning of the range
+    difference_type boundary(size_type i) const noexcept
+    {
+        if (i == m_parts)
+            return m_size;
+
+        // Distribute complete granules evenly, the first subranges get the
+        // remaining granules and the last one gets the incomplete granule,
+        // so that no two subranges differ by more than one granule
+        const size_type grain = (m_grains / m_parts) * i + (i < m_grains % m_parts ? i : m_grains % m_parts);
+        return static_cast< difference_type >(grain) * m_granularity;
+    }
+
+private:
+    Iterator m_first;
+    difference_type m_size;
+    difference_type m_granularity;
+    // Number of complete granules
+    size_type m_grains;
+    size_type m_parts;
+};
+
+template< typename Iterator >
+inline range_partition< Iterator > make_range_partition(
+    Iterator first,
+    Iterator last,
+    std::size_t parts,
+    iterator_difference_t< Iterator > granularity = 1)
+{
+    return range_partition< Iterator >(first, last, parts, granularity);
+}
+
+} // namespace iterators
+
+using iterators::cache_line_granularity;
+using iterators::range_partition;
+using iterators::make_range_partition;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_RANGE_PARTITION_HPP_INCLUDED_
@@ -0,0 +1,408 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_SHARDED_OUTPUT_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_SHARDED_OUTPUT_ITERATOR_HPP_INCLUDED_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/core/empty_value.hpp>
+
+namespace boost {
+namespace iterators {
+
+template< typename T, typename Sink, std::size_t ChunkSize = 256u, bool Ordered = false >
+class sharded_output;
+
+namespace detail {
+
+// A block of elements written by one shard
+template< typename T, std::size_t ChunkSize >
+struct sharded_output_chunk
+{
+    sharded_output_chunk* next = nullptr;
+    // Ordinal and unique id of the shard, and index of the chunk in the shard
+    std::size_t ordinal;
+    std::size_t shard_id;
+    std::size_t sequence;
+    std::size_t size = 0u;
+    alignas(T) unsigned char storage[ChunkSize * sizeof(T)];
+
+    sharded_output_chunk(std::size_t ord, std::size_t id, std::size_t seq) noexcept :
+        ordinal(ord), shard_id(id), sequence(seq)
+    {}
+
+    sharded_output_chunk(sharded_output_chunk const&) = delete;
+    sharded_output_chunk& operator=(sharded_output_chunk const&) = delete;
+
+    ~sharded_output_chunk()
+    {
+        T* const first = data();
+        for (std::size_t i = 0u; i < size; ++i)
+            first[i].~T();
+    }
+
+    T* data() noexcept
+    {
+        return static_cast< T* >(static_cast< void* >(storage));
+    }
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// sharded_output class definition
+//
+// Collects elements written concurrently by several threads and passes
+// them to a sink by chunks of up to ChunkSize elements, by calling
+// sink(first, last) with first and last being of type T const*.
+//
+// Each thread writes through its own shard, which fills a local chunk
+// without synchronization. Full chunks are published to a lock-free
+// multi-producer stack, from which they are delivered to the sink by
+// drain() or flush(), which are called by a single consumer thread.
+//
+// If Ordered is false, chunks are delivered in no particular order, and
+// drain() can deliver them while the shards are being written. If Ordered
+// is true, flush() delivers all elements as the concatenation of the
+// sequences written by the shards, in the order of their ordinals.
+//
+template< typename T, typename Sink, std::size_t ChunkSize, bool Ordered >
+class sharded_output :
+    private boost::empty_value< Sink >
+{
+    static_assert(ChunkSize > 0u, "sharded_output requires non-empty chunks");
+
+private:
+    using sink_base = boost::empty_value< Sink >;
+    using chunk_type = detail::sharded_output_chunk< T, ChunkSize >;
+
+public:
+    class shard;
+    class iterator;
+
+    static constexpr std::size_t chunk_size = ChunkSize;
+    static constexpr bool is_ordered = Ordered;
+
+    explicit sharded_output(Sink const& sink) :
+        sink_base(boost::empty_init_t{}, sink)
+    {}
+
+    sharded_output(sharded_output const&) = delete;
+    sharded_output& operator=(sharded_output const&) = delete;
+
+    // Delivers the remaining elements. Exceptions thrown by the sink are suppressed.
+    ~sharded_output()
+    {
+        BOOST_ASSERT_MSG(m_open_shards.load(std::memory_order_relaxed) == 0u, "sharded_output destroyed while shards are open");
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+
+        release(m_published.exchange(nullptr, std::memory_order_acquire));
+        for (chunk_type* c : m_pending)
+            delete c;
+    }
+
+    // Creates a shard, to be used by a single thread. In ordered mode, the
+    // ordinal determines the position of the elements of the shard in the output.
+    shard make_shard(std::size_t ordinal)
+    {
+        return shard(*this, ordinal, m_shard_count.fetch_add(1u, std::memory_order_relaxed));
+    }
+
+    // Creates a shard of an unordered output
+    shard make_shard()
+    {
+        static_assert(!Ordered, "shards of an ordered sharded_output require an ordinal");
+        return make_shard(0u);
+    }
+
+    // Delivers the chunks published so far to the sink, unless the output is
+    // ordered. Returns the number of delivered elements. Must not be called
+    // concurrently with drain() or flush().
+    std::size_t drain()
+    {
+        chunk_type* list = take_published();
+        if (Ordered)
+        {
+            for (; list != nullptr; list = list->next)
+                m_pending.push_back(list);
+            return 0u;
+        }
+
+        std::size_t n = 0u;
+        try
+        {
+            while (list != nullptr)
+            {
+                deliver(list);
+                n += list->size;
+                chunk_type* const next = list->next;
+                delete list;
+                list = next;
+            }
+        }
+        catch (...)
+        {
+            // Return the undelivered chunks to the stack
+            while (list != nullptr)
+            {
+                chunk_type* const next = list->next;
+                publish(list);
+                list = next;
+            }
+            throw;
+        }
+        return n;
+    }
+
+    // Delivers all elements to the sink. Must be called after all shards are closed.
+    void flush()
+    {
+        BOOST_ASSERT_MSG(m_open_shards.load(std::memory_order_acquire) == 0u, "sharded_output flushed while shards are open");
+
+        drain();
+        if (Ordered)
+        {
+            // Chunks of shards with equal ordinals are kept together
+            std::sort(m_pending.begin(), m_pending.end(), [](chunk_type const* left, chunk_type const* right)
+            {
+                if (left->ordinal != right->ordinal)
+                    return left->ordinal < right->ordinal;
+                if (left->shard_id != right->shard_id)
+                    return left->shard_id < right->shard_id;
+                return left->sequence < right->sequence;
+            });
+
+            std::size_t i = 0u;
+            try
+            {
+                for (; i < m_pending.size(); ++i)
+                {
+                    deliver(m_pending[i]);
+                    delete m_pending[i];
+                }
+            }
+            catch (...)
+            {
+                m_pending.erase(m_pending.begin(), m_pending.begin() + i);
+                throw;
+            }
+            m_pending.clear();
+        }
+    }
+
+    Sink const& sink() const noexcept { return sink_base::get(); }
+    Sink& sink() noexcept { return sink_base::get(); }
+
+private:
+    void publish(chunk_type* c) noexcept
+    {
+        c->next = m_published.load(std::memory_order_relaxed);
+        while (!m_published.compare_exchange_weak(c->next, c, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // Takes all published chunks, in the order of their publication
+    chunk_type* take_published() noexcept
+    {
+        chunk_type* list = m_published.exchange(nullptr, std::memory_order_acquire);
+        chunk_type* reversed = nullptr;
+        while (list != nullptr)
+        {
+            chunk_type* const next = list->next;
+            list->next = reversed;
+            reversed = list;
+            list = next;
+        }
+        return reversed;
+    }
+
+    void deliver(chunk_type* c)
+    {
+        T const* const first = c->data();
+        sink_base::get()(first, first + c->size);
+    }
+
+    static void release(chunk_type* list) noexcept
+    {
+        while (list != nullptr)
+        {
+            chunk_type* const next = list->next;
+            delete list;
+            list = next;
+        }
+    }
+
+private:
+    std::atomic< chunk_type* > m_published{ nullptr };
+    std::atomic< std::size_t > m_open_shards{ 0u };
+    // Number of shards created, used to give them unique ids
+    std::atomic< std::size_t > m_shard_count{ 0u };
+    // Chunks taken from the stack that are waiting for the final flush in ordered mode
+    std::vector< chunk_type* > m_pending;
+};
+
+template< typename T, typename Sink, std::size_t ChunkSize, bool Ordered >
+constexpr std::size_t sharded_output< T, Sink, ChunkSize, Ordered >::chunk_size;
+template< typename T, typename Sink, std::size_t ChunkSize, bool Ordered >
+constexpr bool sharded_output< T, Sink, ChunkSize, Ordered >::is_ordered;
+
+/////////////////////////////////////////////////////////////////////
+//
+// sharded_output::shard class definition
+//
+// The thread-local part of a sharded_output. A shard is movable but
+// not copyable, and publishes its last, partial chunk when it is closed
+// or destroyed.
+//
+template< typename T, typename Sink, std::size_t ChunkSize, bool Ordered >
+class sharded_output< T, Sink, ChunkSize, Ordered >::shard
+{
+    friend class sharded_output;
+
+public:
+    shard(shard&& that) noexcept :
+        m_output(that.m_output), m_chunk(that.m_chunk), m_ordinal(that.m_ordinal), m_id(that.m_id), m_sequence(that.m_sequence)
+    {
+        that.m_output = nullptr;
+        that.m_chunk = nullptr;
+    }
+
+    shard(shard const&) = delete;
+    shard& operator=(shard const&) = delete;
+
+    ~shard()
+    {
+        close();
+    }
+
+    // Returns an output iterator writing to the shard
+    iterator begin() noexcept { return iterator(*this); }
+
+    template< typename U >
+    void push(U&& value)
+    {
+        BOOST_ASSERT(m_output != nullptr);
+        if (m_chunk == nullptr)
+            m_chunk = new chunk_type(m_ordinal, m_id, m_sequence++);
+        ::new (static_cast< void* >(m_chunk->data() + m_chunk->size)) T(static_cast< U&& >(value));
+        if (++m_chunk->size == ChunkSize)
+        {
+            m_output->publish(m_chunk);
+            m_chunk = nullptr;
+        }
+    }
+
+    // Publishes the remaining elements and detaches the shard from the output
+    void close() noexcept
+    {
+        if (m_output != nullptr)
+        {
+            if (m_chunk != nullptr)
+            {
+                m_output->publish(m_chunk);
+                m_chunk = nullptr;
+            }
+            m_output->m_open_shards.fetch_sub(1u, std::memory_order_release);
+            m_output = nullptr;
+        }
+    }
+
+private:
+    shard(sharded_output& output, std::size_t ordinal, std::size_t id) noexcept :
+        m_output(&output), m_ordinal(ordinal), m_id(id)
+    {
+        output.m_open_shards.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+private:
+    sharded_output* m_output;
+    chunk_type* m_chunk = nullptr;
+    std::size_t m_ordinal;
+    std::size_t m_id;
+    std::size_t m_sequence = 0u;
+};
+
+/////////////////////////////////////////////////////////////////////
+//
+// sharded_output::iterator class definition
+//
+// An output iterator writing to a shard, which must outlive the iterator.
+//
+template< typename T, typename Sink, std::size_t ChunkSize, bool Ordered >
+class sharded_output< T, Sink, ChunkSize, Ordered >::iterator
+{
+    friend class shard;
+
+private:
+    class output_proxy
+    {
+    public:
+        explicit output_proxy(shard& s) noexcept :
+            m_shard(s)
+        {}
+
+        template< typename U >
+        typename std::enable_if<
+            !std::is_same< typename std::remove_cv< typename std::remove_reference< U >::type >::type, output_proxy >::value,
+            output_proxy const&
+        >::type operator=(U&& value) const
+        {
+            m_shard.push(static_cast< U&& >(value));
+            return *this;
+        }
+
+        output_proxy(output_proxy const& that) = default;
+        output_proxy& operator=(output_proxy const&) = delete;
+
+    private:
+        shard& m_shard;
+    };
+
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    iterator() = default;
+
+    output_proxy operator*() const { return output_proxy(*m_shard); }
+    iterator& operator++() { return *this; }
+    iterator& operator++(int) { return *this; }
+
+private:
+    explicit iterator(shard& s) noexcept :
+        m_shard(&s)
+    {}
+
+private:
+    shard* m_shard = nullptr;
+};
+
+} // namespace iterators
+
+using iterators::sharded_output;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_SHARDED_OUTPUT_ITERATOR_HPP_INCLUDED_
@@ -0,0 +1,366 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_SORTABLE_ZIP_ITERATOR_HPP_INCLUDED_
+#define BOOST_ITERATOR_SORTABLE_ZIP_ITERATOR_HPP_INCLUDED_
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/mp11/utility.hpp>
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+#include <boost/iterator/iterator_traits.hpp>
+#include <boost/iterator/enable_if_convertible.hpp>
+#include <boost/iterator/zip_iterator.hpp>
+#include <boost/iterator/detail/type_traits/conjunction.hpp>
+
+#if defined(__cpp_concepts) && defined(__has_include)
+#if __has_include(<concepts>)
+#include <concepts>
+#endif
+#endif
+
+namespace boost {
+namespace iterators {
+
+template< typename IteratorTuple >
+class sortable_zip_iterator;
+
+template< typename... References >
+class zip_reference;
+
+template< typename... Values >
+class zip_value;
+
+namespace detail {
+
+// Tells whether every element of the tuple From is convertible to the corresponding element of the tuple To
+template< typename From, typename To, typename = void >
+struct are_elements_convertible :
+    public std::false_type
+{
+};
+
+template< typename... From, typename... To >
+struct are_elements_convertible< std::tuple< From... >, std::tuple< To... >, typename std::enable_if< sizeof...(From) == sizeof...(To) >::type > :
+    public detail::conjunction< std::is_convertible< From, To >... >
+{
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// zip_value class definition
+//
+// The value type of zip_reference: a tuple of values that is copied
+// from the elements referenced by a zip_reference. The elements are
+// only moved out by zip_reference::move_value and iter_move.
+//
+template< typename... Values >
+class zip_value :
+    public std::tuple< Values... >
+{
+    using base_type = std::tuple< Values... >;
+
+public:
+    using base_type::base_type;
+
+    zip_value() = default;
+    zip_value(zip_value const&) = default;
+    zip_value(zip_value&&) = default;
+    zip_value& operator=(zip_value const&) = default;
+    zip_value& operator=(zip_value&&) = default;
+
+    template< typename... References, typename = typename std::enable_if<
+        detail::are_elements_convertible< std::tuple< References... >, base_type >::value
+    >::type >
+    zip_value(zip_reference< References... > const& that) :
+        base_type(static_cast< std::tuple< References... > const& >(that))
+    {}
+};
+
+/////////////////////////////////////////////////////////////////////
+//
+// zip_reference class definition
+//
+// A tuple of references that behaves like a reference to a tuple
+// of values: assignment writes through to the referenced elements,
+// and swapping two zip references swaps the referenced elements.
+// Assigning from another zip reference copies the elements, even if it
+// is an rvalue, since dereferencing an iterator always yields one.
+//
+template< typename... References >
+class zip_reference :
+    public std::tuple< References... >
+{
+    using base_type = std::tuple< References... >;
+    using indices = mp11::index_sequence_for< References... >;
+
+public:
+    // The tuple of values the references refer to
+    using value_type = zip_value< typename std::remove_cv< typename std::remove_reference< References >::type >::type... >;
+
+    explicit zip_reference(base_type const& refs) :
+        base_type(refs)
+    {}
+
+    zip_reference(zip_reference const&) = default;
+
+    // Conversions that make zip_reference< common_reference_t< R, V >... >
+    // the common reference of zip_reference< R... > and zip_value< V... >
+    template< typename... Others, typename = typename std::enable_if<
+        detail::are_elements_convertible< std::tuple< Others... >, base_type >::value
+    >::type >
+    zip_reference(zip_reference< Others... > const& that) :
+        zip_reference(that, indices())
+    {}
+
+    template< typename... Values, typename = typename std::enable_if<
+        detail::are_elements_convertible< std::tuple< Values&... >, base_type >::value
+    >::type >
+    zip_reference(zip_value< Values... >& that) :
+        zip_reference(that, indices())
+    {}
+
+    template< typename... Values, typename = typename std::enable_if<
+        detail::are_elements_convertible< std::tuple< Values const&... >, base_type >::value
+    >::type >
+    zip_reference(zip_value< Values... > const& that) :
+        zip_reference(that, indices())
+    {}
+
+    template< typename... Values, typename = typename std::enable_if<
+        detail::are_elements_convertible< std::tuple< Values&&... >, base_type >::value
+    >::type >
+    zip_reference(zip_value< Values... >&& that) :
+        zip_reference(static_cast< zip_value< Values... >&& >(that), indices())
+    {}
+
+    zip_reference const& operator=(zip_reference const& that) const
+    {
+        assign(that, indices());
+        return *this;
+    }
+
+    zip_reference const& operator=(value_type const& that) const
+    {
+        assign(that, indices());
+        return *this;
+    }
+
+    zip_reference const& operator=(value_type&& that) const
+    {
+        move_assign(that, indices());
+        return *this;
+    }
+
+    // Makes a copy of the referenced elements
+    value_type get_value() const
+    {
+        return value_type(*this);
+    }
+
+    // Moves the referenced elements out
+    value_type move_value() const
+    {
+        return move_value(indices());
+    }
+
+    friend void swap(zip_reference const& left, zip_reference const& right)
+    {
+        left.swap_elements(right, indices());
+    }
+
+private:
+    template< typename Tuple, std::size_t... Is >
+    zip_reference(Tuple&& that, mp11::index_sequence< Is... >) :
+        base_type(std::get< Is >(static_cast< Tuple&& >(that))...)
+    {}
+
+    template< typename Tuple, std::size_t... Is >
+    void assign(Tuple const& that, mp11::index_sequence< Is... >) const
+    {
+        using expand = int[];
+        (void)expand{ 0, ((void)(std::get< Is >(*this) = std::get< Is >(that)), 0)... };
+    }
+
+    template< typename Tuple, std::size_t... Is >
+    void move_assign(Tuple& that, mp11::index_sequence< Is... >) const
+    {
+        using expand = int[];
+        (void)expand{ 0, ((void)(std::get< Is >(*this) = std::move(std::get< Is >(that))), 0)... };
+    }
+
+    template< std::size_t... Is >
+    value_type move_value(mp11::index_sequence< Is... >) const
+    {
+        return value_type(std::move(std::get< Is >(*this))...);
+    }
+
+    template< std::size_t... Is >
+    void swap_elements(zip_reference const& that, mp11::index_sequence< Is... >) const
+    {
+        using std::swap;
+        using expand = int[];
+        (void)expand{ 0, ((void)swap(std::get< Is >(*this), std::get< Is >(that)), 0)... };
+    }
+};
+
+namespace detail {
+
+template< typename IteratorTuple >
+struct sortable_zip_iterator_base;
+
+template< typename... Iterators >
+struct sortable_zip_iterator_base< std::tuple< Iterators... > >
+{
+    using reference = zip_reference< iterator_reference_t< Iterators >... >;
+
+    using traversal = iterator_traversal_t< zip_iterator< std::tuple< Iterators... > > >;
+
+    // zip_reference behaves like a true reference for the purpose of
+    // mutating algorithms, so advertise the standard iterator category
+    // matching the traversal instead of degrading it to input iterator.
+    using category = mp11::mp_cond<
+        std::is_convertible< traversal, random_access_traversal_tag >, std::random_access_iterator_tag,
+        std::is_convertible< traversal, bidirectional_traversal_tag >, std::bidirectional_iterator_tag,
+        std::is_convertible< traversal, forward_traversal_tag >, std::forward_iterator_tag,
+        std::true_type, std::input_iterator_tag
+    >;
+
+    using type = iterator_adaptor<
+        sortable_zip_iterator< std::tuple< Iterators... > >,
+        zip_iterator< std::tuple< Iterators... > >,
+        typename reference::value_type,
+        category,
+        reference
+    >;
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////
+//
+// sortable_zip_iterator class definition
+//
+// Zip iterator whose value type is a tuple of values and whose
+// reference type is a zip_reference, so that the zipped sequences
+// can be permuted in place by mutating algorithms, such as std::sort.
+//
+template< typename IteratorTuple >
+class sortable_zip_iterator :
+    public detail::sortable_zip_iterator_base< IteratorTuple >::type
+{
+    using super_t = typename detail::sortable_zip_iterator_base< IteratorTuple >::type;
+
+    friend class iterator_core_access;
+
+public:
+    using value_type = typename super_t::value_type;
+    using reference = typename super_t::reference;
+
+    sortable_zip_iterator() = default;
+
+    explicit sortable_zip_iterator(IteratorTuple iterator_tuple) :
+        super_t(zip_iterator< IteratorTuple >(iterator_tuple))
+    {}
+
+    template< typename OtherIteratorTuple, typename = enable_if_convertible_t< OtherIteratorTuple, IteratorTuple > >
+    sortable_zip_iterator(sortable_zip_iterator< OtherIteratorTuple > const& other) :
+        super_t(other.base())
+    {}
+
+    IteratorTuple const& get_iterator_tuple() const { return this->base().get_iterator_tuple(); }
+
+    // zip_reference refers to the elements of the zipped sequences, so
+    // it can be returned directly instead of the operator[] proxy
+    reference operator[](typename super_t::difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    friend value_type iter_move(sortable_zip_iterator const& it)
+    {
+        return (*it).move_value();
+    }
+
+    friend void iter_swap(sortable_zip_iterator const& left, sortable_zip_iterator const& right)
+    {
+        swap(*left, *right);
+    }
+
+private:
+    reference dereference() const
+    {
+        return reference(*this->base());
+    }
+};
+
+template< typename... Iterators >
+inline sortable_zip_iterator< std::tuple< Iterators... > > make_sortable_zip_iterator(std::tuple< Iterators... > const& t)
+{
+    return sortable_zip_iterator< std::tuple< Iterators... > >(t);
+}
+
+} // namespace iterators
+
+using iterators::zip_value;
+using iterators::zip_reference;
+using iterators::sortable_zip_iterator;
+using iterators::make_sortable_zip_iterator;
+
+} // namespace boost
+
+#if defined(__cpp_lib_concepts)
+
+namespace boost {
+namespace iterators {
+namespace detail {
+
+// The common reference of zip_reference< R... > and zip_value< V... > with
+// the qualifiers of its reference applied is zip_reference< common_reference_t< R, V >... >,
+// which, like in std::ranges::zip_view, does not require copying the elements
+template< typename References, typename Values, typename = void >
+struct zip_common_reference
+{
+};
+
+template< typename... References, typename... Values >
+struct zip_common_reference< std::tuple< References... >, std::tuple< Values... >, std::void_t< std::common_reference_t< References, Values >... > >
+{
+    using type = boost::iterators::zip_reference< std::common_reference_t< References, Values >... >;
+};
+
+} // namespace detail
+} // namespace iterators
+} // namespace boost
+
+namespace std {
+
+template< typename... References, typename... Values, template< typename > class RQual, template< typename > class VQual >
+struct basic_common_reference< boost::iterators::zip_reference< References... >, boost::iterators::zip_value< Values... >, RQual, VQual > :
+    public boost::iterators::detail::zip_common_reference< std::tuple< References... >, std::tuple< VQual< Values >... > >
+{
+};
+
+template< typename... Values, typename... References, template< typename > class VQual, template< typename > class RQual >
+struct basic_common_reference< boost::iterators::zip_value< Values... >, boost::iterators::zip_reference< References... >, VQual, RQual > :
+    public boost::iterators::detail::zip_common_reference< std::tuple< References... >, std::tuple< VQual< Values >... > >
+{
+};
+
+} // namespace std
+
+#endif // defined(__cpp_lib_concepts)
+
+#endif // BOOST_ITERATOR_SORTABLE_ZIP_ITERATOR_HPP_INCLUDED_
@@ -7,11 +7,13 @@
 #ifndef BOOST_ITERATOR_TRANSFORM_ITERATOR_23022003THW_HPP
 #define BOOST_ITERATOR_TRANSFORM_ITERATOR_23022003THW_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 
 #include <boost/core/use_default.hpp>
 #include <boost/core/empty_value.hpp>
+#include <boost/mp11/utility.hpp>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/enable_if_convertible.hpp>
 #include <boost/iterator/detail/eval_if_default.hpp>
@@ -67,6 +69,49 @@ public:
     >;
 };
 
+// Result of the batch call of a function, f(first, last, out)
+template< typename UnaryFunc, typename T, typename Value >
+using batch_transform_t = decltype(std::declval< UnaryFunc const& >()(std::declval< T const* >(), std::declval< T const* >(), std::declval< Value* >()));
+
+// The trait checks if the function can transform a contiguous block of
+// elements at once. Batch calls are only used with pointers.
+template< typename UnaryFunc, typename Iterator, typename Value >
+struct is_batch_transform :
+    public std::false_type
+{};
+
+template< typename UnaryFunc, typename T, typename Value >
+struct is_batch_transform< UnaryFunc, T*, Value > :
+    public mp11::mp_valid< batch_transform_t, UnaryFunc, typename std::remove_cv< T >::type, Value >
+{};
+
+// Function object that applies Outer to the result of Inner
+template< typename Outer, typename Inner >
+class composed_function :
+    private boost::empty_value< Outer, 0 >,
+    private boost::empty_value< Inner, 1 >
+{
+    using outer_base = boost::empty_value< Outer, 0 >;
+    using inner_base = boost::empty_value< Inner, 1 >;
+
+public:
+    composed_function() = default;
+
+    composed_function(Outer const& outer, Inner const& inner) :
+        outer_base(boost::empty_init_t{}, outer),
+        inner_base(boost::empty_init_t{}, inner)
+    {}
+
+    Outer const& outer() const noexcept { return outer_base::get(); }
+    Inner const& inner() const noexcept { return inner_base::get(); }
+
+    template< typename Arg >
+    auto operator()(Arg&& arg) const -> decltype(std::declval< Outer const& >()(std::declval< Inner const& >()(static_cast< Arg&& >(arg))))
+    {
+        return outer_base::get()(inner_base::get()(static_cast< Arg&& >(arg)));
+    }
+};
+
 } // namespace detail
 
 template< typename UnaryFunc, typename Iterator, typename Reference, typename Value >
@@ -110,6 +155,9 @@ public:
 
     UnaryFunc functor() const { return functor_base::get(); }
 
+    // Returns a reference to the function object stored in the iterator
+    UnaryFunc const& get_functor() const noexcept { return functor_base::get(); }
+
 private:
     typename super_t::reference dereference() const { return functor_base::get()(*this->base()); }
 };
@@ -136,10 +184,95 @@ inline typename std::enable_if<
     return transform_iterator< UnaryFunc, Iterator >(it);
 }
 
+// Same as make_transform_iterator, except that transforming a
+// transform_iterator with default reference and value types produces
+// a single adaptor over the innermost iterator that applies the
+// composition of the functions, instead of nesting adaptors.
+template< typename UnaryFunc, typename Iterator >
+inline transform_iterator< UnaryFunc, Iterator > make_composed_transform_iterator(Iterator it, UnaryFunc fun)
+{
+    return transform_iterator< UnaryFunc, Iterator >(it, fun);
+}
+
+template< typename UnaryFunc, typename InnerFunc, typename Iterator >
+inline transform_iterator< detail::composed_function< UnaryFunc, InnerFunc >, Iterator >
+make_composed_transform_iterator(transform_iterator< InnerFunc, Iterator > const& it, UnaryFunc fun)
+{
+    return transform_iterator< detail::composed_function< UnaryFunc, InnerFunc >, Iterator >(
+        it.base(), detail::composed_function< UnaryFunc, InnerFunc >(fun, it.functor()));
+}
+
+namespace detail {
+
+template< typename UnaryFunc, typename Iterator, typename Reference, typename Value, typename Sink, typename Buffer >
+inline void for_each_chunk_impl(
+    transform_iterator< UnaryFunc, Iterator, Reference, Value > first,
+    transform_iterator< UnaryFunc, Iterator, Reference, Value > const& last,
+    Sink& sink,
+    Buffer& buffer,
+    std::false_type)
+{
+    const std::size_t chunk_size = sizeof(buffer) / sizeof(*buffer);
+    while (first != last)
+    {
+        std::size_t n = 0u;
+        for (; n < chunk_size && first != last; ++n, ++first)
+            buffer[n] = *first;
+        sink(buffer + 0, buffer + n);
+    }
+}
+
+template< typename UnaryFunc, typename Iterator, typename Reference, typename Value, typename Sink, typename Buffer >
+inline void for_each_chunk_impl(
+    transform_iterator< UnaryFunc, Iterator, Reference, Value > const& first,
+    transform_iterator< UnaryFunc, Iterator, Reference, Value > const& last,
+    Sink& sink,
+    Buffer& buffer,
+    std::true_type)
+{
+    const std::ptrdiff_t chunk_size = static_cast< std::ptrdiff_t >(sizeof(buffer) / sizeof(*buffer));
+    const UnaryFunc f = first.functor();
+    Iterator it = first.base();
+    Iterator const end = last.base();
+    while (it != end)
+    {
+        const std::ptrdiff_t n = end - it < chunk_size ? end - it : chunk_size;
+        f(it, it + n, buffer + 0);
+        sink(buffer + 0, buffer + n);
+        it += n;
+    }
+}
+
+} // namespace detail
+
+// Calls sink(chunk_first, chunk_last) for consecutive chunks of at most
+// ChunkSize transformed elements of [first, last), stored in a buffer of
+// value_type. If the underlying iterator is a pointer and the function
+// can be called as f(in_first, in_last, out), the whole chunk is
+// transformed with a single call to the function.
+template< std::size_t ChunkSize = 256u, typename UnaryFunc, typename Iterator, typename Reference, typename Value, typename Sink >
+inline Sink for_each_chunk(
+    transform_iterator< UnaryFunc, Iterator, Reference, Value > const& first,
+    transform_iterator< UnaryFunc, Iterator, Reference, Value > const& last,
+    Sink sink)
+{
+    static_assert(ChunkSize > 0u, "Chunk size must be positive");
+
+    using value_type = typename std::remove_cv<
+        typename transform_iterator< UnaryFunc, Iterator, Reference, Value >::value_type
+    >::type;
+
+    value_type buffer[ChunkSize];
+    detail::for_each_chunk_impl(first, last, sink, buffer, detail::is_batch_transform< UnaryFunc, Iterator, value_type >());
+    return sink;
+}
+
 } // namespace iterators
 
 using iterators::transform_iterator;
 using iterators::make_transform_iterator;
+using iterators::make_composed_transform_iterator;
+using iterators::for_each_chunk;
 
 } // namespace boost
 
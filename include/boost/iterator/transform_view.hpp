@@ -0,0 +1,112 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ITERATOR_TRANSFORM_VIEW_HPP_INCLUDED_
+#define BOOST_ITERATOR_TRANSFORM_VIEW_HPP_INCLUDED_
+
+#include <memory>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+
+namespace boost {
+namespace iterators {
+
+/////////////////////////////////////////////////////////////////////
+//
+// functor_ref class definition
+//
+// A function object that calls another function object through
+// a pointer, so that copying it never copies the referenced function.
+// Unlike std::reference_wrapper, it is default constructible, which
+// is required by transform_iterator.
+//
+template< typename UnaryFunc >
+class functor_ref
+{
+public:
+    functor_ref() = default;
+
+    explicit functor_ref(UnaryFunc const& f) noexcept :
+        m_f(std::addressof(f))
+    {}
+
+    UnaryFunc const& get() const noexcept
+    {
+        BOOST_ASSERT(m_f != nullptr);
+        return *m_f;
+    }
+
+    template< typename... Args >
+    auto operator()(Args&&... args) const -> decltype(std::declval< UnaryFunc const& >()(static_cast< Args&& >(args)...))
+    {
+        return get()(static_cast< Args&& >(args)...);
+    }
+
+private:
+    UnaryFunc const* m_f = nullptr;
+};
+
+/////////////////////////////////////////////////////////////////////
+//
+// transform_view class definition
+//
+// A range of the results of applying a function to the elements of
+// [first, last). The view owns the function object, and its iterators
+// refer to it, so that copying the iterators does not copy the function.
+// The view must outlive the iterators obtained from it.
+//
+template< typename UnaryFunc, typename Iterator >
+class transform_view :
+    private boost::empty_value< UnaryFunc >
+{
+    using functor_base = boost::empty_value< UnaryFunc >;
+
+public:
+    using iterator = transform_iterator< functor_ref< UnaryFunc >, Iterator >;
+    using const_iterator = iterator;
+    using base_iterator = Iterator;
+
+    transform_view(Iterator first, Iterator last, UnaryFunc f) :
+        functor_base(boost::empty_init_t{}, static_cast< UnaryFunc&& >(f)),
+        m_first(static_cast< Iterator&& >(first)),
+        m_last(static_cast< Iterator&& >(last))
+    {}
+
+    UnaryFunc const& functor() const noexcept { return functor_base::get(); }
+    Iterator const& base_begin() const noexcept { return m_first; }
+    Iterator const& base_end() const noexcept { return m_last; }
+
+    iterator begin() const { return iterator(m_first, functor_ref< UnaryFunc >(functor())); }
+    iterator end() const { return iterator(m_last, functor_ref< UnaryFunc >(functor())); }
+
+    // Returns the iterator of the view corresponding to the underlying iterator
+    iterator project(Iterator it) const { return iterator(static_cast< Iterator&& >(it), functor_ref< UnaryFunc >(functor())); }
+
+    bool empty() const { return m_first == m_last; }
+
+private:
+    Iterator m_first;
+    Iterator m_last;
+};
+
+template< typename UnaryFunc, typename Iterator >
+inline transform_view< UnaryFunc, Iterator > make_transform_view(Iterator first, Iterator last, UnaryFunc f)
+{
+    return transform_view< UnaryFunc, Iterator >(static_cast< Iterator&& >(first), static_cast< Iterator&& >(last), static_cast< UnaryFunc&& >(f));
+}
+
+} // namespace iterators
+
+using iterators::functor_ref;
+using iterators::transform_view;
+using iterators::make_transform_view;
+
+} // namespace boost
+
+#endif // BOOST_ITERATOR_TRANSFORM_VIEW_HPP_INCLUDED_
@@ -8,14 +8,20 @@
 #ifndef BOOST_ZIP_ITERATOR_TMB_07_13_2003_HPP_
 #define BOOST_ZIP_ITERATOR_TMB_07_13_2003_HPP_
 
+#include <cstddef>
+#include <tuple>
 #include <utility> // for std::pair
+#include <type_traits>
 
+#include <boost/core/use_default.hpp>
 #include <boost/iterator/iterator_traits.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/iterator/enable_if_convertible.hpp>
 #include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/min_category.hpp>
 
+#include <boost/mp11/algorithm.hpp>
+#include <boost/mp11/integer_sequence.hpp>
 #include <boost/mp11/list.hpp>
 #include <boost/mp11/utility.hpp>
 #include <boost/fusion/adapted/boost_tuple.hpp> // for backward compatibility
@@ -43,11 +49,31 @@ struct void_;
 namespace iterators {
 
 // Zip iterator forward declaration for zip_iterator_base
-template< typename IteratorTuple >
+template< typename IteratorTuple, typename Driver = use_default >
 class zip_iterator;
 
+// Driver policy for zip_iterator. Selects the iterator in the tuple
+// that alone is used to compare zip iterators and to compute the
+// distance between them.
+template< std::size_t N >
+struct zip_driver :
+    public std::integral_constant< std::size_t, N >
+{};
+
 namespace detail {
 
+// Metafunction to obtain the index of the driving iterator. By default,
+// distance is computed using the first iterator in the tuple.
+template< typename Driver >
+struct zip_driver_index :
+    public Driver
+{};
+
+template< >
+struct zip_driver_index< use_default > :
+    public std::integral_constant< std::size_t, 0u >
+{};
+
 // Functors to be used with tuple algorithms
 //
 template< typename DiffType >
@@ -195,7 +221,7 @@ struct minimum_traversal_category_in_iterator_list< tuples::cons< Front, Tail >
 // Builds and exposes the iterator facade type from which the zip
 // iterator will be derived.
 //
-template< typename IteratorTuple >
+template< typename IteratorTuple, typename Driver >
 struct zip_iterator_base
 {
 private:
@@ -206,8 +232,10 @@ private:
     // Value type is the same as reference type.
     using value_type = reference;
 
-    // Difference type is the first iterator's difference type
-    using difference_type = iterator_difference_t< mp11::mp_front< IteratorTuple > >;
+    // Difference type is the driving iterator's difference type
+    using difference_type = iterator_difference_t<
+        mp11::mp_at_c< IteratorTuple, detail::zip_driver_index< Driver >::value >
+    >;
 
     // Traversal catetgory is the minimum traversal category in the
     // iterator tuple.
@@ -217,7 +245,7 @@ public:
     // The iterator facade type from which the zip iterator will
     // be derived.
     using type = iterator_facade<
-        zip_iterator< IteratorTuple >,
+        zip_iterator< IteratorTuple, Driver >,
         value_type,
         traversal_category,
         reference,
@@ -236,15 +264,47 @@ struct converter
     }
 };
 
-template< typename Reference1, typename Reference2 >
-struct converter< std::pair< Reference1, Reference2 > >
+// Dereferences all iterators in the iterator tuple and builds the
+// reference tuple from the results. For generic fusion sequences this
+// goes through a fusion transform view, which is then converted to the
+// reference type.
+template< typename Reference, typename IteratorTuple >
+struct tuple_dereferencer
+{
+    static Reference call(IteratorTuple const& iterator_tuple)
+    {
+        return converter< Reference >::call(fusion::transform(iterator_tuple, dereference_iterator()));
+    }
+};
+
+// std::tuple and std::pair are constructed directly from the dereferenced
+// iterators, without intermediate views and temporaries. This matters in
+// debug builds, where the fusion machinery is not inlined.
+template< typename... References, typename... Iterators >
+struct tuple_dereferencer< std::tuple< References... >, std::tuple< Iterators... > >
+{
+    using reference = std::tuple< References... >;
+
+    static reference call(std::tuple< Iterators... > const& iterator_tuple)
+    {
+        return call_impl(iterator_tuple, mp11::index_sequence_for< Iterators... >());
+    }
+
+    template< std::size_t... Is >
+    static reference call_impl(std::tuple< Iterators... > const& iterator_tuple, mp11::index_sequence< Is... >)
+    {
+        return reference(*std::get< Is >(iterator_tuple)...);
+    }
+};
+
+template< typename Reference1, typename Reference2, typename Iterator1, typename Iterator2 >
+struct tuple_dereferencer< std::pair< Reference1, Reference2 >, std::pair< Iterator1, Iterator2 > >
 {
     using reference = std::pair< Reference1, Reference2 >;
 
-    template< typename Seq >
-    static reference call(Seq seq)
+    static reference call(std::pair< Iterator1, Iterator2 > const& iterator_tuple)
     {
-        return reference(fusion::at_c< 0 >(seq), fusion::at_c< 1 >(seq));
+        return reference(*iterator_tuple.first, *iterator_tuple.second);
     }
 };
 
@@ -254,12 +314,15 @@ struct converter< std::pair< Reference1, Reference2 > >
 //
 // zip_iterator class definition
 //
-template< typename IteratorTuple >
+template< typename IteratorTuple, typename Driver >
 class zip_iterator :
-    public detail::zip_iterator_base< IteratorTuple >::type
+    public detail::zip_iterator_base< IteratorTuple, Driver >::type
 {
     // Typedef super_t as our base class.
-    using super_t = typename detail::zip_iterator_base< IteratorTuple >::type;
+    using super_t = typename detail::zip_iterator_base< IteratorTuple, Driver >::type;
+
+    // Index of the iterator used for comparison and distance calculation
+    using driver_index = detail::zip_driver_index< Driver >;
 
     // iterator_core_access is the iterator's best friend.
     friend class iterator_core_access;
@@ -278,7 +341,7 @@ public:
 
     // Copy constructor
     template< typename OtherIteratorTuple, typename = enable_if_convertible_t< OtherIteratorTuple, IteratorTuple > >
-    zip_iterator(zip_iterator< OtherIteratorTuple > const& other) :
+    zip_iterator(zip_iterator< OtherIteratorTuple, Driver > const& other) :
         m_iterator_tuple(other.get_iterator_tuple())
     {}
 
@@ -294,8 +357,7 @@ private:
     typename super_t::reference dereference() const
     {
         using reference = typename super_t::reference;
-        using gen = detail::converter< reference >;
-        return gen::call(fusion::transform(get_iterator_tuple(), detail::dereference_iterator()));
+        return detail::tuple_dereferencer< reference, IteratorTuple >::call(get_iterator_tuple());
     }
 
     // Two zip iterators are equal if all iterators in the iterator
@@ -308,12 +370,26 @@ private:
     // under several compilers. No point in bringing in a bunch
     // of #ifdefs here.
     //
+    // If a driver is specified, only the driving iterators are compared.
+    //
+    template< typename OtherIteratorTuple >
+    bool equal(zip_iterator< OtherIteratorTuple, Driver > const& other) const
+    {
+        return equal_impl(other, std::is_same< Driver, use_default >());
+    }
+
     template< typename OtherIteratorTuple >
-    bool equal(zip_iterator< OtherIteratorTuple > const& other) const
+    bool equal_impl(zip_iterator< OtherIteratorTuple, Driver > const& other, std::true_type) const
     {
         return fusion::equal_to(get_iterator_tuple(), other.get_iterator_tuple());
     }
 
+    template< typename OtherIteratorTuple >
+    bool equal_impl(zip_iterator< OtherIteratorTuple, Driver > const& other, std::false_type) const
+    {
+        return fusion::at_c< driver_index::value >(get_iterator_tuple()) == fusion::at_c< driver_index::value >(other.get_iterator_tuple());
+    }
+
     // Advancing a zip iterator means to advance all iterators in the
     // iterator tuple.
     void advance(typename super_t::difference_type n)
@@ -335,11 +411,12 @@ private:
         fusion::for_each(m_iterator_tuple, detail::decrement_iterator());
     }
 
-    // Distance is calculated using the first iterator in the tuple.
+    // Distance is calculated using the driving iterator in the tuple,
+    // which is the first one by default.
     template< typename OtherIteratorTuple >
-    typename super_t::difference_type distance_to(zip_iterator< OtherIteratorTuple > const& other) const
+    typename super_t::difference_type distance_to(zip_iterator< OtherIteratorTuple, Driver > const& other) const
     {
-        return fusion::at_c< 0 >(other.get_iterator_tuple()) - fusion::at_c< 0 >(this->get_iterator_tuple());
+        return fusion::at_c< driver_index::value >(other.get_iterator_tuple()) - fusion::at_c< driver_index::value >(this->get_iterator_tuple());
     }
 
 private:
@@ -358,9 +435,18 @@ inline zip_iterator< IteratorTuple > make_zip_iterator(IteratorTuple t)
     return zip_iterator< IteratorTuple >(t);
 }
 
+// Make function for zip iterator driven by the N-th iterator
+//
+template< std::size_t N, typename IteratorTuple >
+inline zip_iterator< IteratorTuple, zip_driver< N > > make_zip_iterator(IteratorTuple t)
+{
+    return zip_iterator< IteratorTuple, zip_driver< N > >(t);
+}
+
 } // namespace iterators
 
 using iterators::zip_iterator;
+using iterators::zip_driver;
 using iterators::make_zip_iterator;
 
 } // namespace boost
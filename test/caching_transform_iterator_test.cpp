@@ -0,0 +1,125 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/caching_transform_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/new_iterator_tests.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+int calls = 0;
+
+// Expensive function, counting its calls
+struct decode
+{
+    std::string operator()(int x) const
+    {
+        ++calls;
+        return std::string(static_cast< std::size_t >(x % 17), 'a');
+    }
+};
+
+int twice(int x)
+{
+    ++calls;
+    return x * 2;
+}
+
+} // namespace
+
+int main()
+{
+    std::vector< int > v;
+    for (int i = 0; i < 100; ++i)
+        v.push_back((i * 37) % 101);
+
+    typedef boost::caching_transform_iterator< decode, std::vector< int >::const_iterator > iterator;
+    static_assert(std::is_same< iterator::value_type, std::string >::value, "value type");
+    static_assert(std::is_same< iterator::reference, std::string const& >::value, "reference type");
+    static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::random_access_iterator_tag >::value,
+        "iterator category");
+
+    // Repeated dereferences of the same position call the function once
+    {
+        calls = 0;
+        iterator it(v.begin());
+        BOOST_TEST(!it.is_cached());
+        std::size_t n = (*it).size();
+        BOOST_TEST_EQ((*it).size(), n);
+        BOOST_TEST_EQ(it->size(), n);
+        BOOST_TEST_EQ(calls, 1);
+        BOOST_TEST(it.is_cached());
+
+        ++it;
+        BOOST_TEST(!it.is_cached());
+        BOOST_TEST_EQ(*it, decode()(v[1]));
+        it += 10;
+        BOOST_TEST_EQ(*it, decode()(v[11]));
+        --it;
+        BOOST_TEST_EQ(*it, decode()(v[10]));
+        std::string element = it[5];
+        BOOST_TEST_EQ(element, decode()(v[15]));
+    }
+
+    // Loops that dereference positions several times
+    {
+        calls = 0;
+        iterator largest = iterator(v.begin());
+        for (iterator it = largest, end = iterator(v.end()); it != end; ++it)
+        {
+            if (*largest < *it)
+                largest = it;
+        }
+        const int cached_calls = calls;
+
+        calls = 0;
+        typedef boost::transform_iterator< decode, std::vector< int >::const_iterator > plain_iterator;
+        plain_iterator plain_largest = plain_iterator(v.begin());
+        for (plain_iterator it = plain_largest, end = plain_iterator(v.end()); it != end; ++it)
+        {
+            if (*plain_largest < *it)
+                plain_largest = it;
+        }
+        const int plain_calls = calls;
+
+        // The stored result is copied along with the iterator, so the function
+        // is called once per element, plus once for the initial largest element
+        BOOST_TEST(largest.base() == plain_largest.base());
+        BOOST_TEST_EQ(cached_calls, static_cast< int >(v.size()) + 1);
+        BOOST_TEST_EQ(plain_calls, 2 * static_cast< int >(v.size()));
+    }
+
+    // Iterator concepts, with a function pointer
+    {
+        int values[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+        int expected[] = { 0, 2, 4, 6, 8, 10, 12, 14 };
+        boost::random_access_readable_iterator_test(
+            boost::make_caching_transform_iterator(values, &twice), 8, expected);
+
+        std::list< int > l(values, values + 8);
+        boost::bidirectional_readable_iterator_test(
+            boost::make_caching_transform_iterator(l.begin(), &twice), 0, 2);
+    }
+
+    // Conversion from a mutable iterator
+    {
+        boost::caching_transform_iterator< decode, std::vector< int >::iterator > it(v.begin() + 1);
+        iterator cit = it;
+        BOOST_TEST(cit.base() == v.begin() + 1);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,197 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/coroutine_generator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_ITERATOR_HAS_COROUTINE_GENERATOR)
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// Bump allocator over a fixed buffer, which never releases memory
+struct arena
+{
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    std::size_t used = 0u;
+    std::size_t allocations = 0u;
+    std::size_t deallocations = 0u;
+};
+
+template< typename T >
+struct arena_allocator
+{
+    using value_type = T;
+
+    arena* a;
+
+    explicit arena_allocator(arena& ar) noexcept : a(&ar) {}
+    template< typename U >
+    arena_allocator(arena_allocator< U > const& that) noexcept : a(that.a) {}
+
+    T* allocate(std::size_t n)
+    {
+        const std::size_t size = (n * sizeof(T) + alignof(std::max_align_t) - 1u) & ~(alignof(std::max_align_t) - 1u);
+        if (a->used + size > sizeof(a->buffer))
+            throw std::bad_alloc();
+        T* p = reinterpret_cast< T* >(a->buffer + a->used);
+        a->used += size;
+        ++a->allocations;
+        return p;
+    }
+
+    void deallocate(T*, std::size_t) noexcept
+    {
+        ++a->deallocations;
+    }
+
+    template< typename U >
+    bool operator==(arena_allocator< U > const& that) const noexcept { return a == that.a; }
+};
+
+struct node
+{
+    int value;
+    node* left;
+    node* right;
+};
+
+// GCC assumes that a frame allocated by a template operator new cannot be
+// released by the non-template operator delete the coroutine is required to call
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// In-order tree walk with nested generators allocated from the arena
+template< typename Alloc >
+boost::coroutine_generator< int > walk(std::allocator_arg_t, Alloc alloc, node const* n)
+{
+    if (n == nullptr)
+        co_return;
+    for (int v : walk(std::allocator_arg, alloc, n->left))
+        co_yield v;
+    co_yield n->value;
+    for (int v : walk(std::allocator_arg, alloc, n->right))
+        co_yield v;
+}
+
+boost::coroutine_generator< std::string > words(int count)
+{
+    for (int i = 0; i < count; ++i)
+        co_yield std::to_string(i);
+}
+
+boost::coroutine_generator< int > failing()
+{
+    co_yield 1;
+    co_yield 2;
+    throw std::runtime_error("generator failure");
+}
+
+struct sequence
+{
+    int first;
+
+    template< typename Alloc >
+    boost::coroutine_generator< int > values(std::allocator_arg_t, Alloc, int count) const
+    {
+        for (int i = 0; i < count; ++i)
+            co_yield first + i;
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace
+
+int main()
+{
+    typedef boost::coroutine_generator< std::string >::iterator iterator;
+    static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::input_iterator_tag >::value,
+        "iterator category");
+    static_assert(std::is_same< std::iterator_traits< iterator >::reference, std::string const& >::value, "reference type");
+
+    // Values are produced lazily
+    {
+        boost::coroutine_generator< std::string > gen = words(5);
+        std::vector< std::string > values(gen.begin(), gen.end());
+        BOOST_TEST_EQ(values.size(), 5u);
+        BOOST_TEST_EQ(values[4], "4");
+
+        boost::coroutine_generator< std::string > empty = words(0);
+        BOOST_TEST(empty.begin() == empty.end());
+
+        boost::coroutine_generator< std::string > partial = words(1000000);
+        iterator it = partial.begin();
+        BOOST_TEST_EQ(*it, "0");
+        ++it;
+        BOOST_TEST_EQ(it->size(), 1u);
+    }
+
+    // Frames allocated from an arena
+    {
+        node nodes[5] = {
+            { 1, nullptr, nullptr },
+            { 2, &nodes[0], &nodes[2] },
+            { 3, nullptr, nullptr },
+            { 4, &nodes[1], &nodes[4] },
+            { 5, nullptr, nullptr }
+        };
+
+        arena ar;
+        {
+            boost::coroutine_generator< int > gen = walk(std::allocator_arg, arena_allocator< char >(ar), &nodes[3]);
+            std::vector< int > values(gen.begin(), gen.end());
+            int expected[] = { 1, 2, 3, 4, 5 };
+            BOOST_TEST_ALL_EQ(values.begin(), values.end(), expected, expected + 5);
+            BOOST_TEST_GT(ar.allocations, 5u);
+        }
+        BOOST_TEST_EQ(ar.allocations, ar.deallocations);
+
+        // Member coroutines
+        ar.used = 0u;
+        sequence seq = { 10 };
+        int sum = 0;
+        for (int v : seq.values(std::allocator_arg, arena_allocator< int >(ar), 4))
+            sum += v;
+        BOOST_TEST_EQ(sum, 46);
+        BOOST_TEST_GT(ar.used, 0u);
+    }
+
+    // Exceptions are rethrown by the iterator
+    {
+        boost::coroutine_generator< int > gen = failing();
+        boost::coroutine_generator< int >::iterator it = gen.begin();
+        BOOST_TEST_EQ(*it, 1);
+        ++it;
+        BOOST_TEST_EQ(*it, 2);
+        BOOST_TEST_THROWS(++it, std::runtime_error);
+        BOOST_TEST(it == gen.end());
+    }
+
+    return boost::report_errors();
+}
+
+#else // defined(BOOST_ITERATOR_HAS_COROUTINE_GENERATOR)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#endif // defined(BOOST_ITERATOR_HAS_COROUTINE_GENERATOR)
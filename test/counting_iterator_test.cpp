@@ -34,7 +34,10 @@
 #include <boost/limits.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iterator>
+#include <utility>
 #include <type_traits>
 #include <stdlib.h>
 #ifndef BOOST_BORLANDC
@@ -256,6 +259,30 @@ private:
   int m_int;
 };
 
+// Test batches of consecutive values
+template <class T>
+void test_batch()
+{
+    boost::counting_iterator<T> it(T(10));
+    std::array<T, 8> values = it.template batch<8>();
+    for (std::size_t i = 0; i < values.size(); ++i)
+        BOOST_TEST(values[i] == T(10 + i));
+    BOOST_TEST(*it == T(10));
+
+    values = it.template next_batch<8>();
+    BOOST_TEST(values[7] == T(17));
+    BOOST_TEST(*it == T(18));
+    values = it.template next_batch<8>();
+    BOOST_TEST(values[0] == T(18));
+    BOOST_TEST(*it == T(26));
+}
+
+template <class Iterator, class = void>
+struct has_batch : std::false_type {};
+
+template <class Iterator>
+struct has_batch<Iterator, decltype(void(std::declval<Iterator const&>().template batch<4>()))> : std::true_type {};
+
 int main()
 {
     // Test the built-in integer types.
@@ -296,5 +323,14 @@ int main()
     int array[2000];
     test(boost::make_counting_iterator(array), boost::make_counting_iterator(array+2000-1));
 
+    // Batches of values for numeric types only
+    test_batch<int>();
+    test_batch<std::int32_t>();
+    test_batch<std::int64_t>();
+    test_batch<unsigned char>();
+    test_batch<double>();
+    static_assert(has_batch<boost::counting_iterator<int> >::value, "numeric types have batches");
+    static_assert(!has_batch<boost::counting_iterator<int*> >::value, "pointers have no batches");
+
     return boost::report_errors();
 }
@@ -0,0 +1,194 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/fd_output_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_HAS_UNISTD_H)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+struct record
+{
+    int id;
+    double amount;
+};
+
+// Temporary file, removed on destruction
+struct temp_file
+{
+    char path[32];
+    int fd;
+
+    temp_file()
+    {
+        std::strcpy(path, "/tmp/fd_output_XXXXXX");
+        fd = ::mkstemp(path);
+    }
+
+    ~temp_file()
+    {
+        ::close(fd);
+        ::unlink(path);
+    }
+
+    std::vector< unsigned char > contents() const
+    {
+        std::vector< unsigned char > data;
+        const int in = ::open(path, O_RDONLY);
+        unsigned char buf[4096];
+        ::ssize_t n;
+        while ((n = ::read(in, buf, sizeof(buf))) > 0)
+            data.insert(data.end(), buf, buf + n);
+        ::close(in);
+        return data;
+    }
+};
+
+} // namespace
+
+int main()
+{
+    typedef boost::fd_output_iterator< int > iterator;
+    static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::output_iterator_tag >::value,
+        "iterator category");
+
+    // Values spanning several rounds of buffers
+    {
+        temp_file file;
+        BOOST_TEST_NE(file.fd, -1);
+
+        std::vector< int > values(100000);
+        std::iota(values.begin(), values.end(), 0);
+        {
+            boost::fd_sink sink(file.fd, 1000u, 3u);
+            BOOST_TEST_EQ(sink.buffer_size() % static_cast< std::size_t >(::sysconf(_SC_PAGESIZE)), 0u);
+            BOOST_TEST_EQ(sink.buffer_count(), 3u);
+            BOOST_TEST(!sink.is_direct());
+
+            std::copy(values.begin(), values.end(), boost::make_fd_output_iterator< int >(sink));
+            BOOST_TEST_LT(sink.pending(), sink.buffer_size() * sink.buffer_count());
+            BOOST_TEST_GT(sink.pending(), 0u);
+        }
+
+        std::vector< unsigned char > data = file.contents();
+        BOOST_TEST_EQ(data.size(), values.size() * sizeof(int));
+        BOOST_TEST(std::memcmp(data.data(), values.data(), data.size()) == 0);
+    }
+
+    // Mixed records and raw bytes, with explicit flushes
+    {
+        temp_file file;
+        boost::fd_sink sink(file.fd);
+        boost::fd_output_iterator< record > it(sink);
+        record r = { 7, 1.5 };
+        *it++ = r;
+        sink.write("abc", 3u);
+        sink.flush();
+        BOOST_TEST_EQ(sink.pending(), 0u);
+        BOOST_TEST_EQ(file.contents().size(), sizeof(record) + 3u);
+
+        r.id = 8;
+        *it = r;
+        sink.flush();
+        std::vector< unsigned char > data = file.contents();
+        BOOST_TEST_EQ(data.size(), 2u * sizeof(record) + 3u);
+        record last;
+        std::memcpy(&last, data.data() + sizeof(record) + 3u, sizeof(record));
+        BOOST_TEST_EQ(last.id, 8);
+        BOOST_TEST_EQ(last.amount, 1.5);
+    }
+
+    // Write errors are reported as exceptions
+    {
+        temp_file file;
+        const int in = ::open(file.path, O_RDONLY);
+        boost::fd_sink sink(in);
+        *boost::make_fd_output_iterator< int >(sink) = 1;
+        BOOST_TEST_THROWS(sink.flush(), std::system_error);
+        BOOST_TEST_EQ(sink.pending(), 0u);
+        ::close(in);
+    }
+
+#if defined(O_DIRECT)
+    // Direct I/O with unaligned tails, if supported by the file system
+    {
+        temp_file file;
+        const int flags = ::fcntl(file.fd, F_GETFL);
+        if (::fcntl(file.fd, F_SETFL, flags | O_DIRECT) != -1)
+        {
+            std::vector< int > values(5000);
+            std::iota(values.begin(), values.end(), 1);
+            const std::size_t half = values.size() / 2u;
+
+            boost::fd_sink sink(file.fd, 4096u, 2u);
+            BOOST_TEST(sink.is_direct());
+
+            // The file system may accept O_DIRECT but not the alignment of the page size
+            bool supported = true;
+            try
+            {
+                std::copy(values.begin(), values.begin() + half, boost::make_fd_output_iterator< int >(sink));
+                sink.flush();
+            }
+            catch (std::system_error& e)
+            {
+                if (e.code() != std::errc::invalid_argument)
+                    throw;
+                supported = false;
+            }
+
+            if (supported)
+            {
+                // The file status flags are left alone
+                BOOST_TEST_EQ(::fcntl(file.fd, F_GETFL), flags | O_DIRECT);
+                BOOST_TEST(sink.is_direct());
+                BOOST_TEST_EQ(sink.pending(), 0u);
+
+                struct ::stat st;
+                BOOST_TEST_EQ(::fstat(file.fd, &st), 0);
+                BOOST_TEST_EQ(static_cast< std::size_t >(st.st_size), half * sizeof(int));
+
+                // Writing after a flush rewrites the unaligned tail
+                std::copy(values.begin() + half, values.end(), boost::make_fd_output_iterator< int >(sink));
+                sink.flush();
+                sink.flush();
+
+                std::vector< unsigned char > data = file.contents();
+                BOOST_TEST_EQ(data.size(), values.size() * sizeof(int));
+                BOOST_TEST(data.size() == values.size() * sizeof(int) && std::memcmp(data.data(), values.data(), data.size()) == 0);
+            }
+        }
+    }
+#endif
+
+    return boost::report_errors();
+}
+
+#else // defined(BOOST_HAS_UNISTD_H)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#endif // defined(BOOST_HAS_UNISTD_H)
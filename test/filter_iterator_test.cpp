@@ -13,8 +13,11 @@
 #include <boost/iterator/iterator_archetypes.hpp>
 #include <boost/cstdlib.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <deque>
+#include <vector>
 
 using boost::dummyT;
 
@@ -26,6 +29,34 @@ struct one_or_four
     }
 };
 
+// Predicate that also tests 16 elements at once
+struct is_multiple_of_7
+{
+    static constexpr std::size_t batch_size = 16;
+
+    bool operator()(int x) const
+    {
+        ++scalar_calls;
+        return x % 7 == 0;
+    }
+
+    std::uint64_t batch_mask(const int* p) const
+    {
+        ++batch_calls;
+        std::uint64_t mask = 0u;
+        for (std::size_t i = 0; i < batch_size; ++i)
+            mask |= static_cast<std::uint64_t>(p[i] % 7 == 0) << i;
+        return mask;
+    }
+
+    static int scalar_calls;
+    static int batch_calls;
+};
+
+constexpr std::size_t is_multiple_of_7::batch_size;
+int is_multiple_of_7::scalar_calls = 0;
+int is_multiple_of_7::batch_calls = 0;
+
 template <class T> struct undefined;
 
 template <class T> struct see_type;
@@ -272,6 +303,37 @@ int main()
         filter_iter(one_or_four(), array, array + N),
         dummyT(1), dummyT(4));
 
+    // Batch predicates skip whole blocks of rejected elements
+    {
+        static_assert(boost::iterators::detail::is_batch_predicate<is_multiple_of_7, int*>::value, "batch predicate is detected for pointers");
+        static_assert(!boost::iterators::detail::is_batch_predicate<is_multiple_of_7, std::deque<int>::iterator>::value, "batch predicate is not used for other iterators");
+        static_assert(!boost::iterators::detail::is_batch_predicate<one_or_four, dummyT*>::value, "regular predicates are not batch predicates");
+
+        std::vector<int> values(100);
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<int>(i) + 1;
+
+        using batch_filter_iter = boost::filter_iterator<is_multiple_of_7, int*>;
+        batch_filter_iter first(values.data(), values.data() + values.size());
+        batch_filter_iter last(values.data() + values.size(), values.data() + values.size());
+
+        std::vector<int> selected(first, last);
+        std::vector<int> expected;
+        for (int i = 7; i <= 100; i += 7)
+            expected.push_back(i);
+        BOOST_TEST_ALL_EQ(selected.begin(), selected.end(), expected.begin(), expected.end());
+        BOOST_TEST(is_multiple_of_7::batch_calls > 0);
+        BOOST_TEST(is_multiple_of_7::scalar_calls < 100);
+
+        // Decrementing still uses the scalar predicate
+        --last;
+        BOOST_TEST_EQ(*last, 98);
+
+        // Sequences with no matches
+        std::vector<int> no_match(50, 1);
+        batch_filter_iter it(no_match.data(), no_match.data() + no_match.size());
+        BOOST_TEST(it.base() == no_match.data() + no_match.size());
+    }
 
     return boost::report_errors();
 }
@@ -0,0 +1,97 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/filter_view.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/new_iterator_tests.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct is_odd
+{
+    bool operator()(int x) const { return (x & 1) != 0; }
+};
+
+// Predicate with a large state, like a lookup table
+struct in_table
+{
+    std::array< bool, 256 > table;
+
+    bool operator()(int x) const { return table[static_cast< unsigned char >(x)]; }
+};
+
+} // namespace
+
+int main()
+{
+    int numbers[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const int N = sizeof(numbers) / sizeof(*numbers);
+
+    // Iterators store the base iterator and a pointer to the view
+    {
+        using view_type = boost::filter_view< in_table, int* >;
+        static_assert(sizeof(view_type::iterator) == sizeof(int*) + sizeof(void*), "iterator size");
+        static_assert(sizeof(boost::filter_view< is_odd, std::list< int >::iterator >::iterator) ==
+            sizeof(std::list< int >::iterator) + sizeof(void*), "iterator size");
+        static_assert(std::is_convertible< boost::iterators::iterator_traversal_t< view_type::iterator >, boost::bidirectional_traversal_tag >::value,
+            "traversal");
+
+        in_table pred;
+        pred.table.fill(false);
+        pred.table[3] = pred.table[5] = pred.table[9] = true;
+
+        view_type view(pred, numbers, numbers + N);
+        int expected[] = { 3, 5, 9 };
+        BOOST_TEST_ALL_EQ(view.begin(), view.end(), expected, expected + 3);
+
+        view_type::iterator it = view.end();
+        --it;
+        BOOST_TEST_EQ(*it, 9);
+        BOOST_TEST(&it.view() == &view);
+        BOOST_TEST(it.base() == numbers + 9);
+    }
+
+    // Traversal concepts
+    {
+        boost::filter_view< is_odd, int* > view = boost::make_filter_view< is_odd >(numbers, numbers + N);
+        int expected[] = { 1, 3, 5, 7, 9 };
+        boost::bidirectional_readable_iterator_test(view.begin(), 1, 3);
+        BOOST_TEST_EQ(std::distance(view.begin(), view.end()), 5);
+        BOOST_TEST_ALL_EQ(view.begin(), view.end(), expected, expected + 5);
+
+        std::vector< int > reversed(std::reverse_iterator< boost::filter_view< is_odd, int* >::iterator >(view.end()),
+            std::reverse_iterator< boost::filter_view< is_odd, int* >::iterator >(view.begin()));
+        BOOST_TEST_EQ(reversed.size(), 5u);
+        BOOST_TEST_EQ(reversed.front(), 9);
+
+        BOOST_TEST_EQ(*view.find(numbers + 4), 5);
+        BOOST_TEST(view.find(numbers + N) == view.end());
+        BOOST_TEST(!view.empty());
+    }
+
+    // Non-class predicates and forward iterators
+    {
+        std::list< int > l(numbers, numbers + N);
+        auto view = boost::make_filter_view(+[](int x) { return x > 6; }, l.begin(), l.end());
+        std::vector< int > selected(view.begin(), view.end());
+        BOOST_TEST_EQ(selected.size(), 3u);
+        BOOST_TEST_EQ(selected.front(), 7);
+
+        auto empty_view = boost::make_filter_view(+[](int x) { return x > 100; }, l.begin(), l.end());
+        BOOST_TEST(empty_view.empty());
+    }
+
+    return boost::report_errors();
+}
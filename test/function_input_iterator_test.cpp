@@ -43,6 +43,21 @@ struct counter {
     }
 };
 
+struct bulk_counter {
+    int n;
+    int calls;
+    explicit bulk_counter(int n_) : n(n_), calls(0) { }
+    void operator() (int* first, std::size_t count) {
+        ++calls;
+        for (std::size_t i = 0; i != count; ++i)
+            first[i] = n++;
+    }
+};
+
+void bulk_ones_function (int* first, std::size_t count) {
+    std::fill(first, first + count, 1);
+}
+
 } // namespace
 
 using namespace std;
@@ -120,5 +135,98 @@ int main()
     for(std::size_t i = 0; i != 10; ++i)
         BOOST_TEST_EQ(generated[i], static_cast<int>(42 + i));
 
+    // test the buffered iterator with a bulk function object
+    bulk_counter bulk_generator(7);
+    vector<int>().swap(generated);
+    copy(
+        boost::make_buffered_function_input_iterator<int, 16>(bulk_generator, 0),
+        boost::make_buffered_function_input_iterator<int, 16>(bulk_generator, 40),
+        back_inserter(generated)
+        );
+
+    BOOST_TEST_EQ(generated.size(), 40u);
+    BOOST_TEST_EQ(bulk_generator.calls, 3);
+    for(std::size_t i = 0; i != 40; ++i)
+        BOOST_TEST_EQ(generated[i], static_cast<int>(7 + i));
+
+    // the function is not called until a value is needed
+    {
+        bulk_counter lazy_generator(0);
+        boost::buffered_function_input_iterator<bulk_counter, int, int, 4> it(lazy_generator, 0);
+        BOOST_TEST_EQ(lazy_generator.calls, 0);
+        BOOST_TEST_EQ(*it, 0);
+        BOOST_TEST_EQ(*it, 0);
+        BOOST_TEST_EQ(it.buffered(), 4u);
+        ++it;
+        ++it;
+        BOOST_TEST_EQ(*it++, 2);
+        BOOST_TEST_EQ(it.buffered(), 1u);
+        ++it;
+        BOOST_TEST_EQ(lazy_generator.calls, 1);
+        BOOST_TEST_EQ(*it, 4);
+        BOOST_TEST_EQ(lazy_generator.calls, 2);
+    }
+
+    // copies of the buffered iterator share the buffer instead of copying it
+    {
+        typedef boost::buffered_function_input_iterator<bulk_counter, int, int, 1024> iterator;
+        BOOST_TEST_LT(sizeof(iterator), 1024 * sizeof(int));
+
+        bulk_counter shared_generator(0);
+        iterator it(shared_generator, 0);
+        ++it;
+        iterator copy = it;
+        BOOST_TEST_EQ(*copy, 1);
+        ++copy;
+        BOOST_TEST_EQ(*copy, 2);
+        BOOST_TEST_EQ(copy.buffered(), 1022u);
+        BOOST_TEST_EQ(shared_generator.calls, 1);
+    }
+
+    // copies taken before the first call share the buffer and the position
+    {
+        typedef boost::buffered_function_input_iterator<bulk_counter, int, int, 4> iterator;
+        bulk_counter shared_generator(0);
+        iterator it(shared_generator, 0);
+        iterator copy = it;
+        BOOST_TEST(copy == it);
+        BOOST_TEST_EQ(*it, 0);
+        BOOST_TEST_EQ(*copy, 0);
+        BOOST_TEST_EQ(shared_generator.calls, 1);
+        ++copy;
+        BOOST_TEST_EQ(*copy, 1);
+        BOOST_TEST_EQ(it.buffered(), 3u);
+
+        // the buffer outlives the iterator it was allocated by
+        iterator last(shared_generator, 0);
+        {
+            iterator first(shared_generator, 0);
+            last = first;
+        }
+        BOOST_TEST_EQ(*last, 4);
+        BOOST_TEST_EQ(shared_generator.calls, 2);
+    }
+
+    // buffers that are skipped without being dereferenced are still generated
+    {
+        bulk_counter skipped_generator(0);
+        boost::buffered_function_input_iterator<bulk_counter, int, int, 4> it(skipped_generator, 0);
+        for (int i = 0; i != 9; ++i)
+            ++it;
+        BOOST_TEST_EQ(skipped_generator.calls, 0);
+        BOOST_TEST_EQ(*it, 9);
+        BOOST_TEST_EQ(skipped_generator.calls, 3);
+    }
+
+    // test the buffered iterator with normal functions and an infinite state
+    vector<int>().swap(generated);
+    boost::buffered_function_input_iterator<void (*)(int*, std::size_t), int, boost::infinite> bulk_ones =
+        boost::make_buffered_function_input_iterator<int>(&bulk_ones_function, boost::infinite());
+    for (int i = 0; i != 100; ++i, ++bulk_ones)
+        generated.push_back(*bulk_ones);
+
+    BOOST_TEST_EQ(generated.size(), 100u);
+    BOOST_TEST_EQ(count(generated.begin(), generated.end(), 1), 100);
+
     return boost::report_errors();
 }
@@ -8,7 +8,11 @@
 #include <boost/core/lightweight_test.hpp>
 #include <boost/iterator/function_output_iterator.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -26,6 +30,31 @@ private:
     int& m_n;
 };
 
+// Records the ranges passed to it
+struct batch_sink
+{
+    explicit batch_sink(std::vector< std::vector< std::string > >& batches) : m_batches(&batches) {}
+
+    void operator() (std::string const* first, std::string const* last) const
+    {
+        m_batches->push_back(std::vector< std::string >(first, last));
+    }
+
+private:
+    std::vector< std::vector< std::string > >* m_batches;
+};
+
+struct throwing_sink
+{
+    int* calls;
+
+    void operator() (int const*, int const*) const
+    {
+        if ((*calls)++ == 0)
+            throw std::runtime_error("sink failure");
+    }
+};
+
 } // namespace
 
 int main()
@@ -57,7 +86,69 @@ int main()
         BOOST_TEST_EQ(n, -6);
     }
 
+    // Buffered output
+    {
+        std::vector< std::vector< std::string > > batches;
+        std::vector< std::string > words;
+        for (int i = 0; i < 10; ++i)
+            words.push_back(std::to_string(i));
+
+        {
+            typedef boost::iterators::buffered_function_output_iterator< batch_sink, std::string, 4 > iterator;
+            batch_sink sink(batches);
+            iterator it(sink);
+
+            it = std::copy(words.begin(), words.end(), it);
+            BOOST_TEST_EQ(batches.size(), 2u);
+            BOOST_TEST_EQ(it.pending(), 2u);
+
+            // Copies flush the source, so that elements are not duplicated
+            iterator copy(it);
+            BOOST_TEST_EQ(batches.size(), 3u);
+            BOOST_TEST_EQ(it.pending(), 0u);
+            *copy++ = "a";
+            *it++ = "b";
+
+            it.flush();
+            BOOST_TEST_EQ(batches.size(), 4u);
+            BOOST_TEST_EQ(batches[3].size(), 1u);
+            BOOST_TEST_EQ(batches[3][0], "b");
+            it.flush();
+            BOOST_TEST_EQ(batches.size(), 4u);
+
+            // Moves transfer the buffered elements
+            iterator moved(std::move(copy));
+            BOOST_TEST_EQ(moved.pending(), 1u);
+            BOOST_TEST_EQ(copy.pending(), 0u);
+        }
+
+        // The destructor flushes the remaining elements
+        BOOST_TEST_EQ(batches.size(), 5u);
+        BOOST_TEST_EQ(batches[4][0], "a");
+
+        std::vector< std::string > all;
+        for (std::size_t i = 0u; i < 3u; ++i)
+            all.insert(all.end(), batches[i].begin(), batches[i].end());
+        BOOST_TEST_ALL_EQ(all.begin(), all.end(), words.begin(), words.end());
+    }
+
+    // Elements are kept when the sink throws
+    {
+        int calls = 0;
+        throwing_sink sink = { &calls };
+        auto it = boost::iterators::make_buffered_function_output_iterator< int, 2 >(sink);
+        *it = 1;
+        BOOST_TEST_THROWS(*it = 2, std::runtime_error);
+        BOOST_TEST_EQ(it.pending(), 2u);
+        *it = 3;
+        BOOST_TEST_EQ(calls, 2);
+        BOOST_TEST_EQ(it.pending(), 1u);
+    }
+
 #if defined(__cpp_lib_concepts) && ( __cpp_lib_concepts >= 202002L )
+    {
+        static_assert(std::output_iterator< boost::iterators::buffered_function_output_iterator< batch_sink, std::string >, std::string >);
+    }
     {
         auto func = [](int) {};
         static_assert(std::output_iterator< boost::iterators::function_output_iterator< decltype(func) >, int >);
@@ -0,0 +1,138 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/galloping_filter_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <vector>
+
+namespace {
+
+// Accepts values in [first, last)
+struct in_window
+{
+    int first;
+    int last;
+    int* calls;
+
+    bool operator()(int x) const
+    {
+        ++*calls;
+        return x >= first && x < last;
+    }
+
+    int skip_hint(int x) const
+    {
+        return x < first ? first : (std::numeric_limits< int >::max)();
+    }
+};
+
+// Accepts values contained in a sorted list
+struct in_sorted
+{
+    std::vector< int > const* values;
+
+    bool operator()(int x) const
+    {
+        return std::binary_search(values->begin(), values->end(), x);
+    }
+
+    int skip_hint(int x) const
+    {
+        std::vector< int >::const_iterator it = std::upper_bound(values->begin(), values->end(), x);
+        return it != values->end() ? *it : (std::numeric_limits< int >::max)();
+    }
+};
+
+// Accepts even values of a range sorted in descending order
+struct even_descending
+{
+    bool operator()(int x) const { return x % 2 == 0; }
+    int skip_hint(int x) const { return x; }
+};
+
+} // namespace
+
+int main()
+{
+    // Time window over sorted timestamps
+    {
+        std::vector< int > timestamps(100000);
+        for (std::size_t i = 0u; i < timestamps.size(); ++i)
+            timestamps[i] = static_cast< int >(i) * 10;
+
+        int calls = 0;
+        in_window pred = { 500000, 500100, &calls };
+        typedef boost::galloping_filter_iterator< in_window, std::vector< int >::const_iterator > iterator;
+        iterator first(pred, timestamps.begin(), timestamps.end());
+        iterator last(pred, timestamps.end(), timestamps.end());
+
+        std::vector< int > selected(first, last);
+        BOOST_TEST_EQ(selected.size(), 10u);
+        BOOST_TEST_EQ(selected.front(), 500000);
+        BOOST_TEST_EQ(selected.back(), 500090);
+
+        // The predicate is not evaluated on the skipped elements
+        BOOST_TEST_LT(calls, 50);
+
+        iterator it = first;
+        ++it;
+        --it;
+        BOOST_TEST_EQ(*it, 500000);
+    }
+
+    // Intersection of posting lists
+    {
+        std::vector< int > a, b;
+        for (int i = 0; i < 10000; ++i)
+            a.push_back(i * 3);
+        for (int i = 0; i < 100; ++i)
+            b.push_back(i * 250 + 1);
+
+        in_sorted pred = { &b };
+        std::vector< int > intersection(
+            boost::make_galloping_filter_iterator(pred, a.begin(), a.end()),
+            boost::make_galloping_filter_iterator(pred, a.end(), a.end()));
+
+        std::vector< int > expected;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        BOOST_TEST_ALL_EQ(intersection.begin(), intersection.end(), expected.begin(), expected.end());
+    }
+
+    // Forward iterators are skipped linearly
+    {
+        std::list< int > l;
+        for (int i = 0; i < 100; ++i)
+            l.push_back(i);
+
+        int calls = 0;
+        in_window pred = { 40, 43, &calls };
+        std::vector< int > selected(
+            boost::make_galloping_filter_iterator(pred, l.begin(), l.end()),
+            boost::make_galloping_filter_iterator(pred, l.end(), l.end()));
+        int expected[] = { 40, 41, 42 };
+        BOOST_TEST_ALL_EQ(selected.begin(), selected.end(), expected, expected + 3);
+    }
+
+    // Custom ordering, including hints that do not move the iterator
+    {
+        int numbers[] = { 9, 8, 7, 5, 3, 2, 1 };
+        std::vector< int > selected(
+            boost::make_galloping_filter_iterator(even_descending(), numbers, numbers + 7, std::greater< int >()),
+            boost::make_galloping_filter_iterator(even_descending(), numbers + 7, numbers + 7, std::greater< int >()));
+        int expected[] = { 8, 2 };
+        BOOST_TEST_ALL_EQ(selected.begin(), selected.end(), expected, expected + 2);
+    }
+
+    return boost::report_errors();
+}
@@ -8,7 +8,17 @@
 
 #include <boost/iterator/generator_iterator.hpp>
 #include <boost/core/lightweight_test.hpp>
+#include <boost/optional/optional.hpp>
 #include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<optional>) && (__cplusplus >= 201703L)
+#include <optional>
+#define BOOST_ITERATOR_TEST_STD_OPTIONAL
+#endif
+#endif
 
 class X
 {
@@ -56,8 +66,88 @@ void copy_test()
     BOOST_TEST_EQ( v[3], 4 );
 }
 
+// Value type without equality
+struct record
+{
+    std::string name;
+    int id;
+};
+
+class Y
+{
+private:
+
+    int n;
+
+public:
+
+    explicit Y( int n_ ): n( n_ )
+    {
+    }
+
+    boost::optional<record> operator()()
+    {
+        if( n == 0 ) return boost::none;
+        record r = { std::string( n, 'x' ), n };
+        --n;
+        return r;
+    }
+};
+
+void optional_test()
+{
+    Y y( 3 );
+    boost::optional_generator_iterator<Y> first = boost::make_optional_generator_iterator( y ), last;
+
+    std::vector<record> v( first, last );
+
+    BOOST_TEST_EQ( v.size(), 3u );
+    BOOST_TEST_EQ( v[0].name, "xxx" );
+    BOOST_TEST_EQ( v[2].id, 1 );
+    BOOST_TEST( first != last );
+
+    Y empty( 0 );
+    BOOST_TEST( boost::make_optional_generator_iterator( empty ) == last );
+
+    Y z( 2 );
+    boost::optional_generator_iterator<Y> it( &z );
+    BOOST_TEST_EQ( it->id, 2 );
+    ++it;
+    BOOST_TEST_EQ( (*it).name, "x" );
+    it++;
+    BOOST_TEST( it == last );
+}
+
+#if defined(BOOST_ITERATOR_TEST_STD_OPTIONAL)
+
+struct countdown
+{
+    int n;
+
+    std::optional<int> operator()()
+    {
+        if( n == 0 ) return std::nullopt;
+        return n--;
+    }
+};
+
+void std_optional_test()
+{
+    countdown c = { 4 };
+    std::vector<int> v( boost::make_optional_generator_iterator( c ), boost::optional_generator_iterator<countdown>() );
+
+    int const expected[] = { 4, 3, 2, 1 };
+    BOOST_TEST_ALL_EQ( v.begin(), v.end(), expected, expected + 4 );
+}
+
+#endif
+
 int main()
 {
     copy_test();
+    optional_test();
+#if defined(BOOST_ITERATOR_TEST_STD_OPTIONAL)
+    std_optional_test();
+#endif
     return boost::report_errors();
 }
@@ -0,0 +1,137 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/indexed_filter_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/range_partition.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct is_multiple_of
+{
+    int divisor;
+
+    bool operator()(int x) const { return x % divisor == 0; }
+};
+
+} // namespace
+
+int main()
+{
+    std::vector< int > v(1000);
+    for (std::size_t i = 0u; i < v.size(); ++i)
+        v[i] = static_cast< int >(i);
+
+    using index_type = boost::filter_index< std::vector< int >::iterator >;
+    using iterator = index_type::iterator;
+
+    static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::random_access_iterator_tag >::value,
+        "indexed_filter_iterator is a random access iterator");
+    static_assert(std::is_same< iterator::reference, int& >::value, "reference type");
+
+    // Selection of every 3rd element
+    {
+        index_type index(is_multiple_of{ 3 }, v.begin(), v.end());
+
+        BOOST_TEST_EQ(index.size(), 334u);
+        BOOST_TEST_EQ(index.base_size(), 1000u);
+        BOOST_TEST_EQ(index.end() - index.begin(), 334);
+
+        std::vector< int > selected(index.begin(), index.end());
+        std::vector< int > expected;
+        for (int i = 0; i < 1000; i += 3)
+            expected.push_back(i);
+        BOOST_TEST_ALL_EQ(selected.begin(), selected.end(), expected.begin(), expected.end());
+
+        // Random access
+        for (std::size_t i = 0u; i < index.size(); ++i)
+        {
+            BOOST_TEST_EQ(index[i], static_cast< int >(3u * i));
+            BOOST_TEST_EQ(index.begin()[static_cast< std::ptrdiff_t >(i)], static_cast< int >(3u * i));
+            BOOST_TEST_EQ(index.select(i), 3u * i);
+            BOOST_TEST_EQ(index.rank(3u * i), i);
+        }
+
+        iterator it = index.begin() + 100;
+        BOOST_TEST_EQ(*it, 300);
+        BOOST_TEST_EQ(it.rank(), 100u);
+        BOOST_TEST(it.base() == v.begin() + 300);
+        it -= 50;
+        BOOST_TEST_EQ(*it, 150);
+        --it;
+        BOOST_TEST_EQ(*it, 147);
+        ++it;
+        BOOST_TEST_EQ(*it, 150);
+        BOOST_TEST_EQ(std::distance(it, index.end()), 284);
+
+        // Binary search over the selected elements
+        iterator found = std::lower_bound(index.begin(), index.end(), 500);
+        BOOST_TEST_EQ(*found, 501);
+        BOOST_TEST(index.find(v.begin() + 499) == found);
+        BOOST_TEST(index.find(v.begin() + 999) == index.end() - 1);
+
+        // Writing through the iterator modifies the underlying sequence
+        *(index.begin() + 1) = 3;
+        BOOST_TEST_EQ(v[3], 3);
+
+        // Reverse traversal
+        std::vector< int > reversed(std::reverse_iterator< iterator >(index.end()), std::reverse_iterator< iterator >(index.begin()));
+        BOOST_TEST_ALL_EQ(reversed.begin(), reversed.end(), expected.rbegin(), expected.rend());
+    }
+
+    // Parallel splitting of a filtered view
+    {
+        index_type index(is_multiple_of{ 7 }, v.begin(), v.end());
+
+        boost::range_partition< iterator > p(index.begin(), index.end(), 4u);
+        BOOST_TEST_EQ(p.size(), 4u);
+
+        long long total = 0;
+        for (std::size_t i = 0u; i < p.size(); ++i)
+        {
+            BOOST_TEST((p[i].second - p[i].first) == 36 || (p[i].second - p[i].first) == 35);
+            for (iterator it = p[i].first; it != p[i].second; ++it)
+                total += *it;
+        }
+
+        long long expected = 0;
+        for (int i = 0; i < 1000; i += 7)
+            expected += i;
+        BOOST_TEST_EQ(total, expected);
+    }
+
+    // Sparse selections spanning empty words
+    {
+        std::vector< int > large(boost::counting_iterator< int >(0), boost::counting_iterator< int >(100000));
+        index_type index(is_multiple_of{ 997 }, large.begin(), large.end());
+
+        BOOST_TEST_EQ(index.size(), 101u);
+        for (std::size_t i = 0u; i < index.size(); ++i)
+            BOOST_TEST_EQ(*(index.begin() + static_cast< std::ptrdiff_t >(i)), static_cast< int >(997u * i));
+        BOOST_TEST_EQ(*(index.end() - 1), 99700);
+        BOOST_TEST(index.test(1994u));
+        BOOST_TEST(!index.test(1995u));
+    }
+
+    // Empty selection
+    {
+        index_type index(is_multiple_of{ 1001 }, v.begin() + 1, v.end());
+
+        BOOST_TEST(index.empty());
+        BOOST_TEST(index.begin() == index.end());
+        BOOST_TEST(index.begin().base() == v.end());
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/indexed_zip_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/iterator_categories.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+int main()
+{
+    std::vector<int> vi = { 1, 2, 3, 4, 5 };
+    std::vector<double> vd = { 0.5, 1.5, 2.5, 3.5, 4.5 };
+    std::vector<char> vc = { 'a', 'b', 'c', 'd', 'e' };
+
+    using iterator = boost::indexed_zip_iterator< std::tuple<int*, double*, char*> >;
+    using const_iterator = boost::indexed_zip_iterator< std::tuple<int const*, double const*, char const*> >;
+
+    static_assert(std::is_same< iterator::reference, std::tuple<int&, double&, char&> >::value, "reference type");
+    static_assert(std::is_same< const_iterator::reference, std::tuple<int const&, double const&, char const&> >::value, "const reference type");
+    static_assert(std::is_convertible<
+        boost::iterator_traversal< iterator >::type,
+        boost::random_access_traversal_tag
+    >::value, "traversal category");
+
+    iterator first = boost::make_indexed_zip_iterator(std::make_tuple(vi.data(), vd.data(), vc.data()));
+    iterator last = first + 5;
+
+    BOOST_TEST_EQ(first.index(), 0);
+    BOOST_TEST_EQ(last.index(), 5);
+    BOOST_TEST_EQ(last - first, 5);
+    BOOST_TEST_EQ(std::distance(first, last), 5);
+    BOOST_TEST(std::get<0>(first.get_base_tuple()) == vi.data());
+    BOOST_TEST(std::get<2>(last.get_iterator_tuple()) == vc.data() + 5);
+
+    BOOST_TEST_EQ(std::get<0>(*first), 1);
+    BOOST_TEST_EQ(std::get<1>(*(first + 2)), 2.5);
+    BOOST_TEST_EQ(std::get<2>(*(last - 1)), 'e');
+
+    {
+        iterator it = first;
+        ++it;
+        BOOST_TEST_EQ(std::get<0>(*it), 2);
+        it += 3;
+        BOOST_TEST_EQ(std::get<2>(*it), 'e');
+        --it;
+        BOOST_TEST_EQ(std::get<1>(*it), 3.5);
+        BOOST_TEST(it < last);
+        BOOST_TEST(it != last);
+        BOOST_TEST(++it == last - 1);
+    }
+
+    // Writes go through to the underlying sequences
+    for (iterator it = first; it != last; ++it)
+    {
+        std::get<0>(*it) *= 10;
+        std::get<1>(*it) += 1.0;
+    }
+    BOOST_TEST_EQ(vi[4], 50);
+    BOOST_TEST_EQ(vd[0], 1.5);
+
+    // Conversion to the constant iterator
+    {
+        const_iterator cfirst = first;
+        const_iterator clast = last;
+        BOOST_TEST(cfirst == first);
+        BOOST_TEST_EQ(clast - cfirst, 5);
+        BOOST_TEST_EQ(std::get<0>(*(cfirst + 1)), 20);
+
+        int sum = 0;
+        std::for_each(cfirst, clast, [&sum](const_iterator::reference r) { sum += std::get<0>(r); });
+        BOOST_TEST_EQ(sum, 150);
+    }
+
+    // Batched access
+    {
+        std::vector<float> x(37), y(37);
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            x[i] = static_cast<float>(i);
+            y[i] = 2.0f;
+        }
+
+        typedef boost::indexed_zip_iterator< std::tuple<float const*, float const*> > column_iterator;
+        column_iterator it = boost::make_indexed_zip_iterator(std::make_tuple(static_cast<float const*>(x.data()), static_cast<float const*>(y.data())));
+        column_iterator const end = it + static_cast<std::ptrdiff_t>(x.size());
+
+        boost::zip_batch< 8, std::tuple<float const*, float const*> > b = it.batch<8>();
+        static_assert(decltype(b)::size() == 8u, "batch size");
+        BOOST_TEST(b.column<0>() == x.data());
+        BOOST_TEST(std::get<1>(b.pointers()) == y.data());
+        BOOST_TEST_EQ(it.index(), 0);
+
+        float dot = 0.0f;
+        while (end - it >= 8)
+        {
+            auto batch = it.next_batch<8>();
+            float const* px = batch.column<0>();
+            float const* py = batch.column<1>();
+            for (std::size_t i = 0; i < batch.size(); ++i)
+                dot += px[i] * py[i];
+        }
+        BOOST_TEST_EQ(it.index(), 32);
+        for (; it != end; ++it)
+            dot += std::get<0>(*it) * std::get<1>(*it);
+
+        BOOST_TEST_EQ(dot, 36.0f * 37.0f);
+    }
+
+    return boost::report_errors();
+}
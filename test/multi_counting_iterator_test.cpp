@@ -0,0 +1,157 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/multi_counting_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/new_iterator_tests.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+typedef std::array< int, 2 > index2;
+typedef std::array< int, 3 > index3;
+
+// Checks that the iterators visit the expected indices, and that
+// random access agrees with stepping through the sequence
+template< typename Iterator, typename Index >
+void test_sequence(Iterator first, Iterator last, std::vector< Index > const& expected)
+{
+    BOOST_TEST_EQ(static_cast< std::size_t >(last - first), expected.size());
+
+    std::vector< Index > visited(first, last);
+    BOOST_TEST(visited == expected);
+
+    for (std::size_t i = 0u; i < expected.size(); ++i)
+    {
+        Index value = *(first + static_cast< std::ptrdiff_t >(i));
+        BOOST_TEST(value == expected[i]);
+        value = *(last - static_cast< std::ptrdiff_t >(expected.size() - i));
+        BOOST_TEST(value == expected[i]);
+    }
+
+    // Stepping backwards
+    Iterator it = last;
+    for (std::size_t i = expected.size(); i-- > 0u;)
+    {
+        --it;
+        BOOST_TEST(*it == expected[i]);
+    }
+    BOOST_TEST(it == first);
+}
+
+int interleave(int x, int y)
+{
+    int code = 0;
+    for (int bit = 0; bit < 8; ++bit)
+        code |= ((x >> bit) & 1) << (2 * bit) | ((y >> bit) & 1) << (2 * bit + 1);
+    return code;
+}
+
+} // namespace
+
+int main()
+{
+    typedef boost::multi_counting_iterator< int, 2 > row_major_iterator;
+    static_assert(std::is_same< std::iterator_traits< row_major_iterator >::iterator_category, std::random_access_iterator_tag >::value,
+        "iterator category");
+    static_assert(std::is_same< row_major_iterator::value_type, index2 >::value, "value type");
+    static_assert(row_major_iterator::dimensions == 2u, "dimensions");
+
+    const index2 lower = {{ 1, -2 }};
+    const index2 upper = {{ 4, 3 }};
+
+    // Row-major order
+    {
+        std::vector< index2 > expected;
+        for (int i = 1; i < 4; ++i)
+            for (int j = -2; j < 3; ++j)
+                expected.push_back(index2{{ i, j }});
+
+        std::pair< row_major_iterator, row_major_iterator > r = boost::make_multi_counting_range(lower, upper);
+        BOOST_TEST_EQ(r.first.size(), 15);
+        BOOST_TEST(r.first.lower() == lower);
+        BOOST_TEST(r.first.upper() == upper);
+        test_sequence(r.first, r.second, expected);
+        boost::random_access_readable_iterator_test(r.first, 15, expected.begin());
+
+        // Splitting the range
+        row_major_iterator middle = r.first + 7;
+        BOOST_TEST_EQ(middle.position(), 7);
+        BOOST_TEST(*middle == expected[7]);
+        BOOST_TEST(r.first < middle && middle < r.second);
+    }
+
+    // Column-major order
+    {
+        std::vector< index2 > expected;
+        for (int j = -2; j < 3; ++j)
+            for (int i = 1; i < 4; ++i)
+                expected.push_back(index2{{ i, j }});
+
+        auto r = boost::make_multi_counting_range< boost::column_major_order >(lower, upper);
+        test_sequence(r.first, r.second, expected);
+    }
+
+    // Tiled order, with partial tiles on the edges
+    {
+        const index3 lower3 = {{ 0, 0, 0 }};
+        const index3 upper3 = {{ 5, 3, 7 }};
+        const int tile[3] = { 2, 2, 3 };
+
+        std::vector< index3 > expected;
+        for (int ti = 0; ti < upper3[0]; ti += tile[0])
+            for (int tj = 0; tj < upper3[1]; tj += tile[1])
+                for (int tk = 0; tk < upper3[2]; tk += tile[2])
+                    for (int i = ti; i < std::min(ti + tile[0], upper3[0]); ++i)
+                        for (int j = tj; j < std::min(tj + tile[1], upper3[1]); ++j)
+                            for (int k = tk; k < std::min(tk + tile[2], upper3[2]); ++k)
+                                expected.push_back(index3{{ i, j, k }});
+
+        auto r = boost::make_multi_counting_range< boost::tiled_order< 2, 2, 3 > >(lower3, upper3);
+        BOOST_TEST_EQ(r.second - r.first, 105);
+        test_sequence(r.first, r.second, expected);
+    }
+
+    // Morton order over a rectangular box
+    {
+        const index2 lower2 = {{ 0, 0 }};
+        const index2 upper2 = {{ 4, 16 }};
+
+        std::vector< index2 > expected;
+        for (int i = 0; i < upper2[0]; ++i)
+            for (int j = 0; j < upper2[1]; ++j)
+                expected.push_back(index2{{ i, j }});
+        // The codes of the box are not contiguous, but their order is the traversal order
+        std::sort(expected.begin(), expected.end(), [](index2 const& a, index2 const& b)
+        {
+            return interleave(a[1], a[0]) < interleave(b[1], b[0]);
+        });
+
+        auto r = boost::make_multi_counting_range< boost::morton_order >(lower2, upper2);
+        test_sequence(r.first, r.second, expected);
+
+        index2 first = *r.first, second = *(r.first + 1), third = *(r.first + 2);
+        BOOST_TEST(first == (index2{{ 0, 0 }}));
+        BOOST_TEST(second == (index2{{ 0, 1 }}));
+        BOOST_TEST(third == (index2{{ 1, 0 }}));
+    }
+
+    // Empty box
+    {
+        auto r = boost::make_multi_counting_range(index2{{ 0, 3 }}, index2{{ 5, 3 }});
+        BOOST_TEST(r.first == r.second);
+    }
+
+    return boost::report_errors();
+}
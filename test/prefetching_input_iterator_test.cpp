@@ -0,0 +1,196 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/prefetching_input_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/optional/optional.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<optional>)
+#include <optional>
+#endif
+#endif
+
+namespace {
+
+// Finite generator of the integers in [0, n)
+struct range_generator
+{
+    int next;
+    int last;
+
+    boost::optional< int > operator()()
+    {
+        if (next == last)
+            return boost::none;
+        return next++;
+    }
+};
+
+// Infinite generator that counts its calls
+struct counting_generator
+{
+    std::shared_ptr< std::atomic< int > > calls;
+
+    std::string operator()()
+    {
+        return std::to_string(calls->fetch_add(1));
+    }
+};
+
+// Generator that sleeps before producing each value, so that the consumer blocks
+struct slow_generator
+{
+    int next;
+    int last;
+
+    boost::optional< int > operator()()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        if (next == last)
+            return boost::none;
+        return next++;
+    }
+};
+
+#if defined(__cpp_lib_optional) && (__cpp_lib_optional >= 201606l)
+struct std_optional_generator
+{
+    int next;
+    int last;
+
+    std::optional< int > operator()()
+    {
+        if (next == last)
+            return std::nullopt;
+        return next++;
+    }
+};
+#endif
+
+struct failing_generator
+{
+    int next;
+
+    boost::optional< int > operator()()
+    {
+        if (next == 100)
+            throw std::runtime_error("generator failure");
+        return next++;
+    }
+};
+
+} // namespace
+
+int main()
+{
+    // Finite sequence, longer than the ring
+    {
+        typedef boost::prefetching_input_iterator< range_generator, 16 > iterator;
+        static_assert(std::is_same< iterator::value_type, int >::value, "value type");
+        static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::input_iterator_tag >::value,
+            "iterator category");
+
+        range_generator gen = { 0, 10000 };
+        std::vector< int > values((iterator(gen)), iterator());
+        BOOST_TEST_EQ(values.size(), 10000u);
+        bool ordered = true;
+        for (std::size_t i = 0u; i < values.size(); ++i)
+            ordered = ordered && values[i] == static_cast< int >(i);
+        BOOST_TEST(ordered);
+    }
+
+    // Both threads block while the other one is stalled
+    {
+        slow_generator gen = { 0, 20 };
+        int sum = 0;
+        for (boost::prefetching_input_iterator< slow_generator, 4 > it(gen), last; it != last; ++it)
+            sum += *it;
+        BOOST_TEST_EQ(sum, 190);
+
+        range_generator fast = { 0, 20 };
+        boost::prefetching_input_iterator< range_generator, 4 > it(fast), last;
+        sum = 0;
+        for (; it != last; ++it)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            sum += *it;
+        }
+        BOOST_TEST_EQ(sum, 190);
+    }
+
+#if defined(__cpp_lib_optional) && (__cpp_lib_optional >= 201606l)
+    // Generators returning std::optional
+    {
+        typedef boost::prefetching_input_iterator< std_optional_generator, 8 > iterator;
+        static_assert(std::is_same< iterator::value_type, int >::value, "value type");
+
+        std_optional_generator gen = { 0, 100 };
+        std::vector< int > values((iterator(gen)), iterator());
+        BOOST_TEST_EQ(values.size(), 100u);
+        BOOST_TEST_EQ(std::accumulate(values.begin(), values.end(), 0), 4950);
+    }
+#endif
+
+    // Empty sequence
+    {
+        range_generator gen = { 5, 5 };
+        BOOST_TEST(boost::make_prefetching_input_iterator(gen) == boost::prefetching_input_iterator< range_generator >());
+    }
+
+    // Early destruction of an infinite sequence stops the producer
+    {
+        std::shared_ptr< std::atomic< int > > calls = std::make_shared< std::atomic< int > >(0);
+        {
+            counting_generator gen = { calls };
+            auto it = boost::make_prefetching_input_iterator< 8 >(gen);
+            BOOST_TEST_EQ(*it, "0");
+            ++it;
+            BOOST_TEST_EQ(*it, "1");
+            auto copy = it;
+            it++;
+            BOOST_TEST_EQ(*copy, "2");
+            BOOST_TEST_EQ(it->size(), 1u);
+        }
+        // The producer may have generated at most one value more than the ring holds
+        BOOST_TEST_LE(calls->load(), 3 + 8 + 1);
+    }
+
+    // Exceptions thrown by the generator are rethrown to the consumer
+    {
+        failing_generator gen = { 0 };
+        boost::prefetching_input_iterator< failing_generator, 4 > it(gen), last;
+        int sum = 0;
+        bool thrown = false;
+        try
+        {
+            for (; it != last; ++it)
+                sum += *it;
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+        BOOST_TEST_EQ(sum, 4950);
+        BOOST_TEST(it == last);
+    }
+
+    return boost::report_errors();
+}
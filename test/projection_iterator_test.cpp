@@ -0,0 +1,113 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/projection_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/is_lvalue_iterator.hpp>
+#include <boost/iterator/new_iterator_tests.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct particle
+{
+    float x;
+    float y;
+    int id;
+};
+
+} // namespace
+
+int main()
+{
+    std::vector< particle > particles(8);
+    for (std::size_t i = 0u; i < particles.size(); ++i)
+    {
+        particles[i].x = static_cast< float >(i);
+        particles[i].y = static_cast< float >(i) * 2.0f;
+        particles[i].id = static_cast< int >(i) + 100;
+    }
+
+    typedef boost::projection_iterator< particle*, float particle::*, &particle::y > y_iterator;
+    typedef boost::projection_iterator< particle const*, int particle::*, &particle::id > const_id_iterator;
+
+    static_assert(std::is_same< y_iterator::reference, float& >::value, "reference type");
+    static_assert(std::is_same< y_iterator::value_type, float >::value, "value type");
+    static_assert(std::is_same< const_id_iterator::reference, int const& >::value, "const reference type");
+    static_assert(std::is_same< std::iterator_traits< y_iterator >::iterator_category, std::random_access_iterator_tag >::value,
+        "iterator category");
+    static_assert(boost::is_lvalue_iterator< y_iterator >::value, "lvalue iterator");
+    static_assert(boost::is_non_const_lvalue_iterator< y_iterator >::value, "mutable lvalue iterator");
+    static_assert(!boost::is_non_const_lvalue_iterator< const_id_iterator >::value, "constant lvalue iterator");
+    static_assert(sizeof(y_iterator) == sizeof(particle*), "no overhead");
+
+    // Strided sequences over pointers
+    static_assert(y_iterator::is_strided, "pointers are strided");
+    static_assert(y_iterator::stride == sizeof(particle), "stride");
+
+    // Reading and writing through the projection
+    {
+        y_iterator first = boost::make_projection_iterator< float particle::*, &particle::y >(particles.data());
+        y_iterator last(particles.data() + particles.size());
+
+        BOOST_TEST_EQ(std::accumulate(first, last, 0.0f), 56.0f);
+        BOOST_TEST_EQ(first[3], 6.0f);
+        BOOST_TEST(first.get_pointer() == &particles[0].y);
+
+        char const* p0 = reinterpret_cast< char const* >((first + 2).get_pointer());
+        char const* p1 = reinterpret_cast< char const* >((first + 3).get_pointer());
+        BOOST_TEST_EQ(static_cast< std::size_t >(p1 - p0), y_iterator::stride);
+
+        std::fill(first, first + 4, -1.0f);
+        BOOST_TEST_EQ(particles[3].y, -1.0f);
+        BOOST_TEST_EQ(particles[4].y, 8.0f);
+        BOOST_TEST_EQ(particles[3].x, 3.0f);
+
+        float expected[] = { -1.0f, -1.0f, -1.0f, -1.0f, 8.0f, 10.0f, 12.0f, 14.0f };
+        boost::random_access_readable_iterator_test(first, 8, expected);
+        boost::non_const_lvalue_iterator_test(first + 4, 8.0f, 42.0f);
+    }
+
+    // Constant objects and conversions
+    {
+        boost::projection_iterator< particle*, int particle::*, &particle::id > it(particles.data() + 1);
+        const_id_iterator cit = it;
+        BOOST_TEST_EQ(*cit, 101);
+        BOOST_TEST(cit == const_id_iterator(particles.data() + 1));
+        boost::constant_lvalue_iterator_test(cit, 101);
+    }
+
+    // Non-contiguous underlying iterators
+    {
+        std::list< particle > l(particles.begin(), particles.end());
+        typedef boost::projection_iterator< std::list< particle >::iterator, int particle::*, &particle::id > list_id_iterator;
+        static_assert(!list_id_iterator::is_strided, "lists are not strided");
+        static_assert(list_id_iterator::stride == 0u, "no stride");
+
+        list_id_iterator first(l.begin()), last(l.end());
+        BOOST_TEST_EQ(std::distance(first, last), 8);
+        boost::bidirectional_readable_iterator_test(first, 100, 101);
+    }
+
+#if defined(__cpp_nontype_template_parameter_auto) && (__cpp_nontype_template_parameter_auto >= 201606l)
+    {
+        auto it = boost::make_projection_iterator< &particle::x >(particles.data());
+        static_assert(std::is_same< decltype(it), boost::projection_iterator< particle*, float particle::*, &particle::x > >::value,
+            "deduced member pointer type");
+        BOOST_TEST_EQ(it[5], 5.0f);
+    }
+#endif
+
+    return boost::report_errors();
+}
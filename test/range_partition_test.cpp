@@ -0,0 +1,165 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/range_partition.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/iterator/zip_iterator.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct square
+{
+    int operator()(int x) const { return x * x; }
+};
+
+// Checks that the partition covers the whole range with adjacent subranges
+template< typename Partition >
+void check_coverage(Partition const& p)
+{
+    BOOST_TEST(p[0].first == p.begin());
+    BOOST_TEST(p[p.size() - 1u].second == p.end());
+    for (std::size_t i = 1u; i < p.size(); ++i)
+        BOOST_TEST(p[i - 1u].second == p[i].first);
+}
+
+} // namespace
+
+int main()
+{
+    // Balanced split of a counting range
+    {
+        typedef boost::counting_iterator< int > iterator;
+        boost::range_partition< iterator > p = boost::make_range_partition(iterator(0), iterator(10), 4u);
+
+        static_assert(std::is_same< boost::range_partition< iterator >::subrange, std::pair< iterator, iterator > >::value, "subrange type");
+
+        BOOST_TEST_EQ(p.size(), 4u);
+        check_coverage(p);
+        BOOST_TEST_EQ(*p[0].first, 0);
+        BOOST_TEST_EQ(p[0].second - p[0].first, 3);
+        BOOST_TEST_EQ(p[1].second - p[1].first, 3);
+        BOOST_TEST_EQ(p[2].second - p[2].first, 2);
+        BOOST_TEST_EQ(p[3].second - p[3].first, 2);
+    }
+
+    // Granularity
+    {
+        typedef boost::counting_iterator< int > iterator;
+        boost::range_partition< iterator > p(iterator(0), iterator(100), 3u, 16);
+
+        BOOST_TEST_EQ(p.size(), 3u);
+        BOOST_TEST_EQ(p.granularity(), 16);
+        check_coverage(p);
+        for (std::size_t i = 0u; i + 1u < p.size(); ++i)
+            BOOST_TEST_EQ(*p[i].second % 16, 0);
+        BOOST_TEST_EQ(p[0].second - p[0].first, 32);
+        BOOST_TEST_EQ(p[1].second - p[1].first, 32);
+        BOOST_TEST_EQ(p[2].second - p[2].first, 36);
+    }
+
+    // Subrange sizes differ by at most the granularity
+    {
+        typedef boost::counting_iterator< int > iterator;
+        bool balanced = true, aligned = true, non_empty = true;
+        for (int size = 1; size <= 200; ++size)
+        {
+            for (std::size_t parts = 1u; parts <= 9u; ++parts)
+            {
+                for (int granularity = 1; granularity <= 20; ++granularity)
+                {
+                    boost::range_partition< iterator > p(iterator(0), iterator(size), parts, granularity);
+                    check_coverage(p);
+
+                    std::ptrdiff_t min_size = size, max_size = 0;
+                    for (std::size_t i = 0u; i < p.size(); ++i)
+                    {
+                        const std::ptrdiff_t n = p[i].second - p[i].first;
+                        min_size = n < min_size ? n : min_size;
+                        max_size = n > max_size ? n : max_size;
+                        non_empty = non_empty && n > 0;
+                        if (i + 1u < p.size())
+                            aligned = aligned && n % granularity == 0;
+                    }
+                    balanced = balanced && max_size - min_size <= granularity;
+                }
+            }
+        }
+        BOOST_TEST(balanced);
+        BOOST_TEST(aligned);
+        BOOST_TEST(non_empty);
+    }
+
+    // More parts than elements yields no empty subranges
+    {
+        typedef boost::counting_iterator< int > iterator;
+        boost::range_partition< iterator > p(iterator(0), iterator(3), 8u);
+
+        BOOST_TEST_EQ(p.size(), 3u);
+        check_coverage(p);
+        for (std::size_t i = 0u; i < p.size(); ++i)
+            BOOST_TEST_EQ(p[i].second - p[i].first, 1);
+    }
+
+    // Empty range yields a single empty subrange
+    {
+        typedef boost::counting_iterator< int > iterator;
+        boost::range_partition< iterator > p(iterator(5), iterator(5), 4u);
+
+        BOOST_TEST_EQ(p.size(), 1u);
+        BOOST_TEST(p[0].first == p[0].second);
+    }
+
+    // Adapted iterators
+    {
+        std::vector< int > v(1000);
+        for (std::size_t i = 0u; i < v.size(); ++i)
+            v[i] = static_cast< int >(i);
+
+        typedef boost::transform_iterator< square, std::vector< int >::const_iterator > transform_iterator;
+        boost::range_partition< transform_iterator > tp = boost::make_range_partition(
+            transform_iterator(v.begin(), square()),
+            transform_iterator(v.end(), square()),
+            7u,
+            static_cast< std::ptrdiff_t >(boost::cache_line_granularity< int >()));
+
+        check_coverage(tp);
+        long long total = 0;
+        for (std::size_t i = 0u; i < tp.size(); ++i)
+        {
+            for (transform_iterator it = tp[i].first; it != tp[i].second; ++it)
+                total += *it;
+        }
+        BOOST_TEST_EQ(total, 332833500ll);
+
+        typedef boost::zip_iterator< std::tuple< std::vector< int >::iterator, boost::counting_iterator< int > > > zip_iterator;
+        boost::range_partition< zip_iterator > zp = boost::make_range_partition(
+            boost::make_zip_iterator(std::make_tuple(v.begin(), boost::counting_iterator< int >(0))),
+            boost::make_zip_iterator(std::make_tuple(v.end(), boost::counting_iterator< int >(1000))),
+            6u);
+
+        check_coverage(zp);
+        for (std::size_t i = 0u; i < zp.size(); ++i)
+        {
+            for (zip_iterator it = zp[i].first; it != zp[i].second; ++it)
+                BOOST_TEST_EQ(std::get< 0 >(*it), std::get< 1 >(*it));
+        }
+    }
+
+    BOOST_TEST_EQ(boost::cache_line_granularity< char >(), 64u);
+    BOOST_TEST_EQ(boost::cache_line_granularity< double >(), boost::cache_line_granularity< char >() / sizeof(double));
+    BOOST_TEST_EQ(boost::cache_line_granularity< char[1024] >(), 1u);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Shards of an ordered output must be given an ordinal
+#include <boost/iterator/sharded_output_iterator.hpp>
+
+namespace {
+
+struct null_sink
+{
+    void operator()(int const*, int const*) const {}
+};
+
+} // namespace
+
+int main()
+{
+    boost::sharded_output< int, null_sink, 16, true > output((null_sink()));
+    boost::sharded_output< int, null_sink, 16, true >::shard s = output.make_shard();
+    s.close();
+
+    return 0;
+}
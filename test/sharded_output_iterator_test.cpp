@@ -0,0 +1,207 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/sharded_output_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+const int thread_count = 8;
+const int values_per_thread = 10000;
+
+// Appends the delivered elements to a vector, which is only accessed by the consumer
+struct vector_sink
+{
+    std::vector< int >* values;
+    std::size_t* calls;
+
+    void operator()(int const* first, int const* last) const
+    {
+        values->insert(values->end(), first, last);
+        ++*calls;
+    }
+};
+
+struct failing_sink
+{
+    std::vector< std::string >* values;
+    std::size_t limit;
+
+    void operator()(std::string const* first, std::string const* last) const
+    {
+        if (values->size() + static_cast< std::size_t >(last - first) > limit)
+            throw std::runtime_error("sink failure");
+        values->insert(values->end(), first, last);
+    }
+};
+
+template< typename Output >
+void produce(Output& output)
+{
+    std::vector< std::thread > threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        typename Output::shard s = output.make_shard(static_cast< std::size_t >(t));
+        threads.emplace_back([t](typename Output::shard s)
+        {
+            std::vector< int > input(values_per_thread);
+            std::iota(input.begin(), input.end(), t * values_per_thread);
+            std::copy_if(input.begin(), input.end(), s.begin(), [](int) { return true; });
+        }, static_cast< typename Output::shard&& >(s));
+    }
+    for (std::thread& th : threads)
+        th.join();
+}
+
+} // namespace
+
+int main()
+{
+    typedef boost::sharded_output< int, vector_sink, 100 > unordered_output;
+    typedef unordered_output::iterator iterator;
+    static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::output_iterator_tag >::value,
+        "iterator category");
+    static_assert(!std::is_copy_constructible< unordered_output::shard >::value, "shards are not copyable");
+
+    // Unordered output, drained concurrently with the producers
+    {
+        std::vector< int > values;
+        std::size_t calls = 0u;
+        vector_sink sink = { &values, &calls };
+        unordered_output output(sink);
+
+        std::atomic< bool > done{ false };
+        std::size_t drained = 0u;
+        std::thread consumer([&]()
+        {
+            while (!done.load(std::memory_order_acquire))
+            {
+                drained += output.drain();
+                std::this_thread::yield();
+            }
+        });
+        produce(output);
+        done.store(true, std::memory_order_release);
+        consumer.join();
+        output.flush();
+
+        BOOST_TEST_EQ(values.size(), static_cast< std::size_t >(thread_count * values_per_thread));
+        BOOST_TEST_LE(drained, values.size());
+        BOOST_TEST_EQ(calls, static_cast< std::size_t >(thread_count * values_per_thread / 100));
+        std::sort(values.begin(), values.end());
+        bool complete = true;
+        for (std::size_t i = 0u; i < values.size(); ++i)
+            complete = complete && values[i] == static_cast< int >(i);
+        BOOST_TEST(complete);
+    }
+
+    // Ordered output is the concatenation of the shards, regardless of the scheduling
+    {
+        std::vector< int > values;
+        std::size_t calls = 0u;
+        vector_sink sink = { &values, &calls };
+        boost::sharded_output< int, vector_sink, 64, true > output(sink);
+        produce(output);
+        BOOST_TEST_EQ(output.drain(), 0u);
+        BOOST_TEST(values.empty());
+        output.flush();
+
+        BOOST_TEST_EQ(values.size(), static_cast< std::size_t >(thread_count * values_per_thread));
+        bool ordered = true;
+        for (std::size_t i = 0u; i < values.size(); ++i)
+            ordered = ordered && values[i] == static_cast< int >(i);
+        BOOST_TEST(ordered);
+    }
+
+    // Shards with equal ordinals are not interleaved
+    {
+        std::vector< int > values;
+        std::size_t calls = 0u;
+        vector_sink sink = { &values, &calls };
+        boost::sharded_output< int, vector_sink, 2, true > output(sink);
+        {
+            auto s1 = output.make_shard(1u);
+            auto s2 = output.make_shard(1u);
+            auto s0 = output.make_shard(0u);
+            for (int i = 0; i < 6; ++i)
+            {
+                *s1.begin() = 10 + i;
+                *s2.begin() = 20 + i;
+            }
+            *s0.begin() = 0;
+        }
+        output.flush();
+
+        BOOST_TEST_EQ(values.size(), 13u);
+        BOOST_TEST_EQ(values[0], 0);
+        const int first = values[1] == 10 ? 10 : 20;
+        const int second = first == 10 ? 20 : 10;
+        bool together = true;
+        for (int i = 0; i < 6; ++i)
+        {
+            together = together && values[1u + static_cast< std::size_t >(i)] == first + i;
+            together = together && values[7u + static_cast< std::size_t >(i)] == second + i;
+        }
+        BOOST_TEST(together);
+    }
+
+    // Partial chunks are published when the shards are closed, and by the destructor
+    {
+        std::vector< int > values;
+        std::size_t calls = 0u;
+        vector_sink sink = { &values, &calls };
+        {
+            unordered_output output(sink);
+            unordered_output::shard s1 = output.make_shard();
+            iterator it = s1.begin();
+            *it++ = 1;
+            *it++ = 2;
+            s1.close();
+            BOOST_TEST_EQ(output.drain(), 2u);
+
+            unordered_output::shard s2 = output.make_shard();
+            *s2.begin() = 3;
+        }
+        BOOST_TEST_EQ(values.size(), 3u);
+        BOOST_TEST_EQ(values[2], 3);
+        BOOST_TEST_EQ(calls, 2u);
+    }
+
+    // Undelivered chunks are kept if the sink throws
+    {
+        std::vector< std::string > values;
+        failing_sink sink = { &values, 4u };
+        boost::sharded_output< std::string, failing_sink, 4, true > output(sink);
+        {
+            auto s = output.make_shard(1u);
+            std::fill_n(s.begin(), 6, std::string("b"));
+            auto t = output.make_shard(0u);
+            std::fill_n(t.begin(), 4, std::string("a"));
+        }
+        BOOST_TEST_THROWS(output.flush(), std::runtime_error);
+        BOOST_TEST_EQ(values.size(), 4u);
+        BOOST_TEST_EQ(values[0], "a");
+
+        output.sink().limit = 10u;
+        output.flush();
+        BOOST_TEST_EQ(values.size(), 10u);
+        BOOST_TEST_EQ(values[4], "b");
+    }
+
+    return boost::report_errors();
+}
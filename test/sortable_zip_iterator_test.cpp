@@ -0,0 +1,250 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/sortable_zip_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct key_less
+{
+    template< typename T, typename U >
+    bool operator()(T const& left, U const& right) const
+    {
+        return std::get< 0 >(left) < std::get< 0 >(right);
+    }
+};
+
+// Counts its copies, which swapping and moving should not make
+struct counted
+{
+    static int copies;
+
+    int value;
+
+    explicit counted(int v) : value(v) {}
+    counted(counted const& that) : value(that.value) { ++copies; }
+    counted(counted&&) = default;
+    counted& operator=(counted const& that) { value = that.value; ++copies; return *this; }
+    counted& operator=(counted&&) = default;
+};
+
+int counted::copies = 0;
+
+} // namespace
+
+int main()
+{
+    typedef std::vector< int >::iterator int_iterator;
+    typedef std::vector< std::string >::iterator string_iterator;
+    typedef boost::sortable_zip_iterator< std::tuple< int_iterator, string_iterator > > iterator;
+
+    static_assert(std::is_same< iterator::value_type, boost::zip_value< int, std::string > >::value, "value type");
+    static_assert(std::is_base_of< std::tuple< int, std::string >, iterator::value_type >::value, "value type");
+#if defined(__cpp_lib_concepts)
+    static_assert(std::random_access_iterator< iterator >, "random access iterator");
+    static_assert(std::sortable< iterator >, "sortable");
+#endif
+    static_assert(std::is_same< iterator::reference, boost::zip_reference< int&, std::string& > >::value, "reference type");
+
+    // Assignment and swap through zip references
+    {
+        std::vector< int > keys = { 1, 2 };
+        std::vector< std::string > names = { "one", "two" };
+
+        iterator it = boost::make_sortable_zip_iterator(std::make_tuple(keys.begin(), names.begin()));
+
+        // Lvalue references are copied from
+        iterator::reference first_ref = *it;
+        iterator::value_type v = first_ref;
+        BOOST_TEST_EQ(std::get< 0 >(v), 1);
+        BOOST_TEST_EQ(std::get< 1 >(v), "one");
+        BOOST_TEST_EQ(names[0], "one");
+
+        iterator::reference second_ref = *(it + 1);
+        *it = second_ref;
+        BOOST_TEST_EQ(keys[0], 2);
+        BOOST_TEST_EQ(names[0], "two");
+        BOOST_TEST_EQ(names[1], "two");
+
+        *(it + 1) = v;
+        BOOST_TEST_EQ(keys[1], 1);
+        BOOST_TEST_EQ(names[1], "one");
+
+        iter_swap(it, it + 1);
+        BOOST_TEST_EQ(keys[0], 1);
+        BOOST_TEST_EQ(names[0], "one");
+        BOOST_TEST_EQ(keys[1], 2);
+        BOOST_TEST_EQ(names[1], "two");
+
+        // Plain reads copy, even from rvalue references
+        *(it + 1) = *it;
+        BOOST_TEST_EQ(keys[1], 1);
+        BOOST_TEST_EQ(names[1], "one");
+        BOOST_TEST_EQ(names[0], "one");
+
+        iterator::value_type copied = *it;
+        BOOST_TEST_EQ(std::get< 1 >(copied), "one");
+        BOOST_TEST_EQ(names[0], "one");
+
+        // Only iter_move moves
+        iterator::value_type moved = iter_move(it);
+        BOOST_TEST_EQ(std::get< 1 >(moved), "one");
+        BOOST_TEST(names[0].empty());
+
+        *it = std::move(moved);
+        BOOST_TEST_EQ(names[0], "one");
+    }
+
+    // Copying out of the range leaves the source intact
+    {
+        std::vector< int > keys = { 1, 2, 3 };
+        std::vector< std::string > names = { "one", "two", "three" };
+        iterator first = boost::make_sortable_zip_iterator(std::make_tuple(keys.begin(), names.begin()));
+
+        std::vector< iterator::value_type > rows;
+        std::copy(first, first + 3, std::back_inserter(rows));
+        BOOST_TEST_EQ(rows.size(), 3u);
+        BOOST_TEST_EQ(std::get< 1 >(rows[2]), "three");
+
+        std::vector< std::string > sorted_names = { "one", "two", "three" };
+        BOOST_TEST_ALL_EQ(names.begin(), names.end(), sorted_names.begin(), sorted_names.end());
+    }
+
+    // Sorting structure-of-arrays data by the key column
+    {
+        std::vector< int > keys = { 5, 3, 9, 1, 7, 3 };
+        std::vector< std::string > names = { "five", "three", "nine", "one", "seven", "three" };
+
+        iterator first = boost::make_sortable_zip_iterator(std::make_tuple(keys.begin(), names.begin()));
+        iterator last = boost::make_sortable_zip_iterator(std::make_tuple(keys.end(), names.end()));
+
+        std::sort(first, last, key_less());
+
+        std::vector< int > sorted_keys = { 1, 3, 3, 5, 7, 9 };
+        std::vector< std::string > sorted_names = { "one", "three", "three", "five", "seven", "nine" };
+        BOOST_TEST_ALL_EQ(keys.begin(), keys.end(), sorted_keys.begin(), sorted_keys.end());
+        BOOST_TEST_ALL_EQ(names.begin(), names.end(), sorted_names.begin(), sorted_names.end());
+
+        std::sort(first, last);
+        BOOST_TEST(std::is_sorted(first, last));
+    }
+
+    // Stable sort keeps the order of equivalent rows
+    {
+        std::vector< int > keys = { 2, 1, 2, 1, 2, 1 };
+        std::vector< std::string > names = { "a", "b", "c", "d", "e", "f" };
+
+        iterator first = boost::make_sortable_zip_iterator(std::make_tuple(keys.begin(), names.begin()));
+        iterator last = first + static_cast< std::ptrdiff_t >(keys.size());
+
+        std::stable_sort(first, last, key_less());
+
+        std::vector< int > sorted_keys = { 1, 1, 1, 2, 2, 2 };
+        std::vector< std::string > sorted_names = { "b", "d", "f", "a", "c", "e" };
+        BOOST_TEST_ALL_EQ(keys.begin(), keys.end(), sorted_keys.begin(), sorted_keys.end());
+        BOOST_TEST_ALL_EQ(names.begin(), names.end(), sorted_names.begin(), sorted_names.end());
+    }
+
+    // Other mutating algorithms
+    {
+        std::vector< int > keys = { 1, 2, 3, 4 };
+        std::vector< std::string > names = { "1", "2", "3", "4" };
+
+        iterator first = boost::make_sortable_zip_iterator(std::make_tuple(keys.begin(), names.begin()));
+        iterator last = first + 4;
+
+        std::reverse(first, last);
+        BOOST_TEST_EQ(keys[0], 4);
+        BOOST_TEST_EQ(names[0], "4");
+
+        std::rotate(first, first + 1, last);
+        BOOST_TEST_EQ(keys[0], 3);
+        BOOST_TEST_EQ(names[0], "3");
+        BOOST_TEST_EQ(keys[3], 4);
+        BOOST_TEST_EQ(names[3], "4");
+    }
+
+    // Swapping and iter_move do not copy the elements
+    {
+        typedef boost::sortable_zip_iterator< std::tuple< std::vector< int >::iterator, std::vector< counted >::iterator > > counted_iterator;
+
+        std::vector< int > keys;
+        std::vector< counted > values;
+        for (int i = 0; i < 21; ++i)
+        {
+            keys.push_back((i * 8) % 21);
+            values.push_back(counted(keys.back() * 10));
+        }
+
+        counted_iterator first(std::make_tuple(keys.begin(), values.begin()));
+        counted_iterator last(std::make_tuple(keys.end(), values.end()));
+
+        counted::copies = 0;
+        std::reverse(first, last);
+        BOOST_TEST_EQ(counted::copies, 0);
+        BOOST_TEST_EQ(values[0].value, keys[0] * 10);
+
+        std::sort(first, last, key_less());
+        BOOST_TEST(std::is_sorted(keys.begin(), keys.end()));
+        bool together = true;
+        for (std::size_t i = 0u; i < keys.size(); ++i)
+            together = together && values[i].value == keys[i] * 10;
+        BOOST_TEST(together);
+
+        counted::copies = 0;
+        counted_iterator::value_type row = *first;
+        BOOST_TEST_EQ(counted::copies, 1);
+        counted_iterator::value_type moved_row = iter_move(first + 1);
+        BOOST_TEST_EQ(counted::copies, 1);
+        *(first + 1) = std::move(moved_row);
+        BOOST_TEST_EQ(counted::copies, 1);
+        BOOST_TEST_EQ(std::get< 1 >(row).value, values[0].value);
+        BOOST_TEST_EQ(values[1].value, keys[1] * 10);
+    }
+
+    // Move-only elements can be permuted by swapping
+    {
+        typedef boost::sortable_zip_iterator< std::tuple< std::vector< int >::iterator, std::vector< std::unique_ptr< int > >::iterator > > ptr_iterator;
+
+        std::vector< int > keys = { 3, 1, 4, 1, 5, 9, 2, 6 };
+        std::vector< std::unique_ptr< int > > values;
+        for (int k : keys)
+            values.emplace_back(new int(k));
+
+        ptr_iterator first(std::make_tuple(keys.begin(), values.begin()));
+        ptr_iterator last(std::make_tuple(keys.end(), values.end()));
+#if defined(__cpp_lib_concepts)
+        static_assert(std::permutable< ptr_iterator >, "permutable");
+#endif
+
+        std::reverse(first, last);
+        BOOST_TEST_EQ(keys[0], 6);
+        std::iter_swap(first, first + 7);
+        BOOST_TEST_EQ(keys[0], 3);
+        bool together = true;
+        for (std::size_t i = 0u; i < keys.size(); ++i)
+            together = together && values[i] && *values[i] == keys[i];
+        BOOST_TEST(together);
+        BOOST_TEST_EQ(*std::get< 1 >(first[7]), 6);
+
+        ptr_iterator::value_type row = iter_move(first);
+        BOOST_TEST(!values[0]);
+        *first = std::move(row);
+        BOOST_TEST_EQ(*values[0], 3);
+    }
+
+    return boost::report_errors();
+}
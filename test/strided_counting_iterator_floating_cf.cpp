@@ -0,0 +1,15 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Strided counting requires an integral type, the step would be truncated otherwise
+#include <boost/iterator/counting_iterator.hpp>
+
+int main()
+{
+    boost::make_strided_counting_range(0.0, 1.0, 0.25);
+
+    return 0;
+}
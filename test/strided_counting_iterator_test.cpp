@@ -0,0 +1,159 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/new_iterator_tests.hpp>
+#include <boost/iterator/permutation_iterator.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+int main()
+{
+    // Runtime step
+    {
+        typedef boost::strided_counting_iterator< int > iterator;
+        static_assert(std::is_same< std::iterator_traits< iterator >::iterator_category, std::random_access_iterator_tag >::value
+            || std::is_same< std::iterator_traits< iterator >::iterator_category, std::input_iterator_tag >::value, "iterator category");
+        static_assert(std::is_convertible< boost::iterators::iterator_traversal_t< iterator >, boost::random_access_traversal_tag >::value,
+            "random access traversal");
+        static_assert(!std::is_convertible< int, iterator >::value, "construction from a value is explicit");
+
+        // The default runtime step is 1
+        iterator unit(5);
+        BOOST_TEST_EQ(unit.step(), 1);
+        BOOST_TEST_EQ(*++unit, 6);
+
+        iterator it(5, 3);
+        BOOST_TEST_EQ(*it, 5);
+        BOOST_TEST_EQ(it.step(), 3);
+        ++it;
+        BOOST_TEST_EQ(*it, 8);
+        it += 4;
+        BOOST_TEST_EQ(*it, 20);
+        it -= 2;
+        BOOST_TEST_EQ(*it, 14);
+        --it;
+        BOOST_TEST_EQ(*it, 11);
+        BOOST_TEST_EQ(iterator(20, 3) - iterator(5, 3), 5);
+        BOOST_TEST_EQ(iterator(5, 3) - iterator(20, 3), -5);
+
+        int expected[] = { 0, 3, 6, 9, 12 };
+        boost::random_access_readable_iterator_test(iterator(0, 3), 5, expected);
+    }
+
+    // Partial last strides
+    {
+        typedef boost::strided_counting_iterator< int > iterator;
+        std::pair< iterator, iterator > r = boost::make_strided_counting_range(0, 10, 3);
+        BOOST_TEST_EQ(*r.second, 12);
+        BOOST_TEST_EQ(r.second - r.first, 4);
+        BOOST_TEST(r.first + (r.second - r.first) == r.second);
+        BOOST_TEST_EQ(std::distance(r.first, r.second), 4);
+        iterator it = r.first;
+        std::advance(it, std::distance(r.first, r.second));
+        BOOST_TEST(it == r.second);
+        std::vector< int > values(r.first, r.second);
+        int expected[] = { 0, 3, 6, 9 };
+        BOOST_TEST_ALL_EQ(values.begin(), values.end(), expected, expected + 4);
+
+        static_assert(std::is_same< decltype(boost::make_strided_counting_iterator(0, 3)), iterator >::value,
+            "runtime steps use the default step type");
+        BOOST_TEST(boost::make_strided_counting_iterator(9, 3) < boost::make_strided_counting_iterator(12, 3));
+        BOOST_TEST(!(boost::make_strided_counting_iterator(12, 3) < boost::make_strided_counting_iterator(9, 3)));
+
+        // Exact and empty ranges
+        r = boost::make_strided_counting_range(0, 9, 3);
+        BOOST_TEST_EQ(*r.second, 9);
+        r = boost::make_strided_counting_range(5, 5, 3);
+        BOOST_TEST(r.first == r.second);
+        r = boost::make_strided_counting_range(5, 0, 3);
+        BOOST_TEST(r.first == r.second);
+    }
+
+    // Negative steps
+    {
+        std::pair< boost::strided_counting_iterator< int >, boost::strided_counting_iterator< int > > r =
+            boost::make_strided_counting_range(10, 0, -4);
+        std::vector< int > values(r.first, r.second);
+        int expected[] = { 10, 6, 2 };
+        BOOST_TEST_ALL_EQ(values.begin(), values.end(), expected, expected + 3);
+        BOOST_TEST_EQ(*r.second, -2);
+    }
+
+    // End iterators past the largest value of the type
+    {
+        typedef boost::strided_counting_iterator< unsigned char > iterator;
+        std::pair< iterator, iterator > r = boost::make_strided_counting_range((unsigned char)250, (unsigned char)255, 10);
+        BOOST_TEST_EQ(r.second - r.first, 1);
+        BOOST_TEST_EQ(r.first - r.second, -1);
+        std::vector< unsigned char > values(r.first, r.second);
+        BOOST_TEST_EQ(values.size(), 1u);
+        BOOST_TEST_EQ(values[0], 250u);
+        iterator it = r.first;
+        ++it;
+        BOOST_TEST(it == r.second);
+        BOOST_TEST(--it == r.first);
+
+        std::pair< iterator, iterator > full = boost::make_strided_counting_range((unsigned char)0, (unsigned char)255, 2);
+        BOOST_TEST_EQ(full.second - full.first, 128);
+        BOOST_TEST_EQ(std::distance(full.first, full.second), 128);
+        BOOST_TEST_EQ(*(full.second - 1), 254u);
+
+        std::pair< boost::strided_counting_iterator< int >, boost::strided_counting_iterator< int > > top =
+            boost::make_strided_counting_range(INT_MAX - 5, INT_MAX, 4);
+        BOOST_TEST_EQ(top.second - top.first, 2);
+        BOOST_TEST_EQ(*(top.first + 1), INT_MAX - 1);
+
+        std::pair< boost::strided_counting_iterator< int >, boost::strided_counting_iterator< int > > bottom =
+            boost::make_strided_counting_range(INT_MIN + 5, INT_MIN, -4);
+        BOOST_TEST_EQ(bottom.second - bottom.first, 2);
+        std::vector< int > bottom_values(bottom.first, bottom.second);
+        BOOST_TEST_EQ(bottom_values.size(), 2u);
+        BOOST_TEST_EQ(bottom_values[1], INT_MIN + 1);
+    }
+
+    // Compile time step
+    {
+        typedef std::integral_constant< std::ptrdiff_t, 4 > step;
+        typedef boost::strided_counting_iterator< std::size_t, step > iterator;
+        static_assert(sizeof(iterator) < sizeof(boost::strided_counting_iterator< std::size_t >), "compile time steps are not stored");
+
+        iterator it = boost::make_strided_counting_iterator(std::size_t(2), step());
+        BOOST_TEST_EQ(it.step(), 4);
+        BOOST_TEST_EQ(*(it + 3), 14u);
+        BOOST_TEST_EQ(iterator(18u) - it, 4);
+        BOOST_TEST_EQ(it - iterator(18u), -4);
+
+        std::pair< iterator, iterator > r = boost::make_strided_counting_range(std::size_t(2), std::size_t(19), step());
+        BOOST_TEST_EQ(*r.second, 22u);
+        BOOST_TEST_EQ(r.second - r.first, 5);
+    }
+
+    // Column access with permutation_iterator
+    {
+        // 3x4 row-major matrix
+        int matrix[] = {
+            0, 1, 2, 3,
+            10, 11, 12, 13,
+            20, 21, 22, 23
+        };
+
+        typedef boost::strided_counting_iterator< std::ptrdiff_t, std::integral_constant< std::ptrdiff_t, 4 > > index_iterator;
+        boost::permutation_iterator< int*, index_iterator > first(matrix, index_iterator(1)), last(matrix, index_iterator(13));
+        int expected[] = { 1, 11, 21 };
+        BOOST_TEST_EQ(std::distance(first, last), 3);
+        BOOST_TEST_ALL_EQ(first, last, expected, expected + 3);
+    }
+
+    return boost::report_errors();
+}
@@ -15,6 +15,9 @@
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <algorithm>
+#include <cstddef>
+#include <list>
+#include <vector>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/new_iterator_tests.hpp>
@@ -111,6 +114,48 @@ struct polymorphic_mult_functor
     void operator()(const T& _arg) { BOOST_ASSERT(0); }
 };
 
+// Function that also converts blocks of elements at once
+struct batch_mult_functor
+{
+  static int batch_calls;
+
+  int operator()(int x) const { return x * 3; }
+
+  void operator()(const int* first, const int* last, int* out) const
+  {
+    ++batch_calls;
+    for (; first != last; ++first, ++out)
+      *out = *first * 3;
+  }
+};
+
+int batch_mult_functor::batch_calls = 0;
+
+// Collects the chunks passed to it
+struct chunk_collector
+{
+  std::vector<int> values;
+  std::size_t chunks;
+
+  chunk_collector() : chunks(0) {}
+
+  void operator()(int* first, int* last)
+  {
+    ++chunks;
+    values.insert(values.end(), first, last);
+  }
+};
+
+struct add_one
+{
+  int operator()(int x) const { return x + 1; }
+};
+
+struct square
+{
+  long operator()(int x) const { return static_cast<long>(x) * x; }
+};
+
 int
 main()
 {
@@ -272,5 +317,78 @@ main()
         boost::make_transform_iterator(y, polymorphic_mult_functor()), N, x);
   }
 
+  // Chunked traversal
+  {
+    static_assert(boost::iterators::detail::is_batch_transform<batch_mult_functor, int*, int>::value, "batch transform detection");
+    static_assert(boost::iterators::detail::is_batch_transform<batch_mult_functor, const int*, int>::value, "batch transform detection");
+    static_assert(!boost::iterators::detail::is_batch_transform<batch_mult_functor, std::list<int>::iterator, int>::value, "batch transform detection");
+    static_assert(!boost::iterators::detail::is_batch_transform<mult_functor, int*, int>::value, "batch transform detection");
+
+    std::vector<int> in(1000);
+    std::vector<int> expected(in.size());
+    for (std::size_t k = 0; k < in.size(); ++k)
+    {
+      in[k] = static_cast<int>(k);
+      expected[k] = static_cast<int>(k) * 3;
+    }
+
+    // Batch calls for pointers
+    chunk_collector c = boost::for_each_chunk<64>(
+        boost::make_transform_iterator(in.data(), batch_mult_functor())
+      , boost::make_transform_iterator(in.data() + in.size(), batch_mult_functor())
+      , chunk_collector());
+    BOOST_TEST_ALL_EQ(c.values.begin(), c.values.end(), expected.begin(), expected.end());
+    BOOST_TEST_EQ(c.chunks, 16u);
+    BOOST_TEST_EQ(batch_mult_functor::batch_calls, 16);
+
+    // Element-wise calls for other iterators
+    std::list<int> l(in.begin(), in.end());
+    c = boost::for_each_chunk<64>(
+        boost::make_transform_iterator(l.begin(), batch_mult_functor())
+      , boost::make_transform_iterator(l.end(), batch_mult_functor())
+      , chunk_collector());
+    BOOST_TEST_ALL_EQ(c.values.begin(), c.values.end(), expected.begin(), expected.end());
+    BOOST_TEST_EQ(c.chunks, 16u);
+    BOOST_TEST_EQ(batch_mult_functor::batch_calls, 16);
+
+    // Empty ranges
+    c = boost::for_each_chunk(
+        boost::make_transform_iterator(in.data(), batch_mult_functor())
+      , boost::make_transform_iterator(in.data(), batch_mult_functor())
+      , chunk_collector());
+    BOOST_TEST_EQ(c.chunks, 0u);
+  }
+
+  // Nested transforms are composed into a single adaptor
+  {
+    int x[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    long expected[] = { 1, 4, 9, 16, 25, 36, 49, 64 };
+
+    auto first = boost::make_composed_transform_iterator(boost::make_transform_iterator(x, add_one()), square());
+    auto last = boost::make_composed_transform_iterator(boost::make_transform_iterator(x + 8, add_one()), square());
+
+    typedef boost::transform_iterator<boost::iterators::detail::composed_function<square, add_one>, int*> composed_iterator;
+    STATIC_ASSERT_SAME(decltype(first), composed_iterator);
+    STATIC_ASSERT_SAME(decltype(first)::reference, long);
+    static_assert(sizeof(first) == sizeof(int*), "composed iterator over empty functions has the size of the base iterator");
+    BOOST_TEST(first.base() == x);
+    BOOST_TEST_ALL_EQ(first, last, expected, expected + 8);
+
+    // Three levels, including function pointers
+    auto it = boost::make_composed_transform_iterator(
+        boost::make_composed_transform_iterator(boost::make_composed_transform_iterator(x, add_one()), &mult_2), square());
+    long expected3[] = { 4, 16, 36, 64, 100, 144, 196, 256 };
+    STATIC_ASSERT_SAME(std::decay<decltype(it.base())>::type, int*);
+    BOOST_TEST_EQ(*(it + 3), 64);
+    boost::random_access_readable_iterator_test(it, 8, expected3);
+
+    // make_transform_iterator still nests the adaptors
+    typedef boost::transform_iterator<add_one, int*> inner_iterator;
+    boost::transform_iterator<square, inner_iterator> nested =
+        boost::make_transform_iterator(boost::make_transform_iterator(x, add_one()), square());
+    STATIC_ASSERT_SAME(decltype(nested.base()), inner_iterator const&);
+    BOOST_TEST_EQ(*(nested + 2), 9);
+  }
+
   return boost::report_errors();
 }
@@ -0,0 +1,88 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/transform_view.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/iterator/new_iterator_tests.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+int copies = 0;
+
+// Stateful function that counts its copies
+struct lookup
+{
+    std::map< int, std::string > table;
+
+    lookup() = default;
+    lookup(lookup const& that) : table(that.table) { ++copies; }
+    lookup(lookup&&) = default;
+
+    std::string const& operator()(int key) const { return table.find(key)->second; }
+};
+
+} // namespace
+
+int main()
+{
+    lookup f;
+    f.table[1] = "one";
+    f.table[2] = "two";
+    f.table[3] = "three";
+
+    int keys[] = { 3, 1, 2, 2, 1, 3, 3 };
+    const int N = sizeof(keys) / sizeof(*keys);
+
+    // Iterator copies never copy the function
+    {
+        typedef boost::transform_view< lookup, int* > view_type;
+        view_type view(keys, keys + N, std::move(f));
+
+        static_assert(std::is_same< view_type::iterator::reference, std::string const& >::value, "reference type");
+        static_assert(sizeof(view_type::iterator) == sizeof(int*) + sizeof(void*), "iterator size");
+
+        copies = 0;
+        view_type::iterator first = view.begin(), last = view.end();
+        view_type::iterator it = first;
+        it = last;
+
+        std::vector< std::string > values(first, last);
+        BOOST_TEST_EQ(values.size(), 7u);
+        BOOST_TEST_EQ(values[0], "three");
+        BOOST_TEST_EQ(std::count(first, last, std::string("three")), 3);
+        BOOST_TEST(std::find(first, last, std::string("two")) == view.project(keys + 2));
+        BOOST_TEST_EQ(*std::max_element(first, last), "two");
+        boost::random_access_readable_iterator_test(first, N, values.begin());
+
+        BOOST_TEST_EQ(copies, 0);
+
+        // The function is accessible by reference
+        BOOST_TEST(&first.get_functor().get() == &view.functor());
+        BOOST_TEST(&last.get_functor().get() == &view.functor());
+        BOOST_TEST_EQ(view.functor().table.size(), 3u);
+    }
+
+    // std::function
+    {
+        std::function< int(int) > twice = [](int x) { return x * 2; };
+        auto view = boost::make_transform_view(keys, keys + N, twice);
+        int expected[] = { 6, 2, 4, 4, 2, 6, 6 };
+        BOOST_TEST_ALL_EQ(view.begin(), view.end(), expected, expected + N);
+        BOOST_TEST(!view.empty());
+    }
+
+    return boost::report_errors();
+}
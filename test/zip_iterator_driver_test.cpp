@@ -0,0 +1,104 @@
+// Copyright 2026 Boost.Iterator contributors.
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/iterator/zip_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+std::size_t comparisons = 0;
+
+// Iterator that counts how many times it is compared for equality
+class counted_iterator :
+    public boost::iterator_adaptor< counted_iterator, int* >
+{
+    friend class boost::iterator_core_access;
+
+public:
+    counted_iterator() = default;
+    explicit counted_iterator(int* p) : iterator_adaptor_(p) {}
+
+private:
+    bool equal(counted_iterator const& that) const
+    {
+        ++comparisons;
+        return this->base() == that.base();
+    }
+};
+
+} // namespace
+
+int main()
+{
+    int a[5] = { 1, 2, 3, 4, 5 };
+    int b[5] = { 10, 20, 30, 40, 50 };
+    int c[5] = { 100, 200, 300, 400, 500 };
+
+    typedef std::tuple< counted_iterator, counted_iterator, counted_iterator > iterator_tuple;
+
+    // By default, all iterators are compared
+    {
+        boost::zip_iterator< iterator_tuple > first = boost::make_zip_iterator(iterator_tuple(counted_iterator(a), counted_iterator(b), counted_iterator(c)));
+        boost::zip_iterator< iterator_tuple > last = boost::make_zip_iterator(iterator_tuple(counted_iterator(a + 5), counted_iterator(b + 5), counted_iterator(c + 5)));
+
+        comparisons = 0;
+        BOOST_TEST(first == first);
+        BOOST_TEST_EQ(comparisons, 3u);
+        BOOST_TEST(first != last);
+    }
+
+    // With a driver, only the driving iterator is compared
+    {
+        typedef boost::zip_iterator< iterator_tuple, boost::zip_driver< 1 > > driven_iterator;
+
+        driven_iterator first = boost::make_zip_iterator< 1 >(iterator_tuple(counted_iterator(a), counted_iterator(b), counted_iterator(c)));
+        driven_iterator last = boost::make_zip_iterator< 1 >(iterator_tuple(counted_iterator(a + 5), counted_iterator(b + 5), counted_iterator(c + 5)));
+
+        comparisons = 0;
+        int sum = 0;
+        for (driven_iterator it = first; it != last; ++it)
+            sum += std::get< 0 >(*it) + std::get< 1 >(*it) + std::get< 2 >(*it);
+
+        BOOST_TEST_EQ(sum, 1665);
+        BOOST_TEST_EQ(comparisons, 6u);
+        BOOST_TEST_EQ(last - first, 5);
+        BOOST_TEST(first + 5 == last);
+    }
+
+    // The end of the driving sequence determines the end of the range
+    {
+        std::vector< int > v1 = { 1, 2, 3 };
+        std::vector< int > v2 = { 4, 5, 6, 7, 8 };
+
+        typedef std::tuple< std::vector< int >::iterator, std::vector< int >::iterator > tuple_type;
+        typedef boost::zip_iterator< tuple_type, boost::zip_driver< 0 > > driven_iterator;
+
+        static_assert(std::is_same<
+            driven_iterator,
+            decltype(boost::make_zip_iterator< 0 >(tuple_type()))
+        >::value, "make_zip_iterator<N> must return a driven zip_iterator");
+
+        driven_iterator first(tuple_type(v1.begin(), v2.begin()));
+        driven_iterator last(tuple_type(v1.end(), v2.begin() + 1));
+
+        int n = 0;
+        for (driven_iterator it = first; it != last; ++it)
+            ++n;
+        BOOST_TEST_EQ(n, 3);
+        BOOST_TEST_EQ(last - first, 3);
+        BOOST_TEST(first < last);
+    }
+
+    return boost::report_errors();
+}